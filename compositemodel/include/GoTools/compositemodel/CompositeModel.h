@@ -63,6 +63,7 @@ enum closestPointLevel
  class SurfaceModel;
  class IntResultsModel;
  class LineCloud;
+ class GenericTriMesh;
  
 //===========================================================================
 /** Abstract base class for a volume model, surface model or curve model.
@@ -225,6 +226,24 @@ class GO_API CompositeModel
   void tesselate(double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const = 0;
 
+  /// Tesselate model with respect to a given resolution and merge the
+  /// meshes into one triangle mesh. Vertices closer than weld_tol are
+  /// welded, so faces sharing an edge are connected in the result.
+  /// Suitable for export with the functions in MeshExport.
+  /// \param resolution[] Given resolution
+  /// \param weld_tol Tolerance for merging vertices
+  /// \return The merged mesh
+  shared_ptr<GenericTriMesh> tesselateWelded(int resolution[],
+					     double weld_tol) const;
+
+  /// Tesselate model with respect to a given tesselation density and
+  /// merge the meshes into one triangle mesh, see above
+  /// \param density Tesselation density
+  /// \param weld_tol Tolerance for merging vertices
+  /// \return The merged mesh
+  shared_ptr<GenericTriMesh> tesselateWelded(double density,
+					     double weld_tol) const;
+
   /// Return a tesselation of the control polygon of this entity
   /// \retval ctr_pol Tesselated control polygon of this entity
   virtual 
@@ -70,6 +70,7 @@ namespace Go
  class Loop;
  class Body;
  struct SamplePointData;
+ class GenericTriMesh;
 
 //===========================================================================
 /** A surface set or shell including topological information
@@ -309,6 +310,26 @@ class GO_API SurfaceModel : public CompositeModel
   /// \return Closest point
   ftPoint closestPoint(const ftPoint& point) { return closestPoint(point.position()); }
 
+  /// Closest points between a set of points and this surface model.
+  /// The points are sorted by the cells in the cell division and
+  /// spatially within each cell. Each point is first projected onto the
+  /// face where the closest point of the previous point was found, which
+  /// gives a distance bound for the traversal of the cells. The
+  /// projections are run in parallel if OpenMP is enabled. They work on
+  /// private copies of the surfaces, the model is not changed.
+  /// \param pts Input points, stored consecutively
+  /// \param nmb_pts Number of input points
+  /// \param idx Index of the face where the closest point is found,
+  ///            -1 if no closest point is found
+  /// \param clo_par Parameter values of the closest points, two per point
+  /// \param dist Distances between the input points and the closest points
+  /// \param clo_pnt Closest points, stored as the input points
+  void closestPoints(const double* pts, int nmb_pts,
+		     std::vector<int>& idx,
+		     std::vector<double>& clo_par,
+		     std::vector<double>& dist,
+		     std::vector<double>& clo_pnt) const;
+
 
   /// Extremal point(s) in a given direction
   /// Note that the found extremal point may be less accurate for trimmed surfaces
@@ -634,6 +655,33 @@ class GO_API SurfaceModel : public CompositeModel
 		 double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
 
+  /// Tesselate all surfaces into one triangle mesh. The triangles are
+  /// refined with respect to the geometry, and the surfaces share the
+  /// sampling of common edges, so the mesh has no cracks between faces.
+  /// \param chord_tol Maximum distance between triangles and surfaces
+  /// \param angle_tol Maximum angle between surface normals in the
+  /// corners of a triangle
+  /// \retval mesh Tesselated model
+  /// \retval failed Indices of the faces that could not be tesselated.
+  /// These faces are missing in the mesh
+  void tesselateAdaptive(double chord_tol, double angle_tol,
+			 shared_ptr<GenericTriMesh>& mesh,
+			 std::vector<int>& failed) const;
+
+  /// Tesselate specified surfaces into one triangle mesh with respect to
+  /// a chordal tolerance and an angular tolerance
+  /// \param faces Specified surfaces
+  /// \param chord_tol Maximum distance between triangles and surfaces
+  /// \param angle_tol Maximum angle between surface normals in the
+  /// corners of a triangle
+  /// \retval mesh Tesselated surfaces
+  /// \retval failed Indices in faces of the surfaces that could not be
+  /// tesselated. These surfaces are missing in the mesh
+  void tesselateAdaptive(const std::vector<shared_ptr<ftFaceBase> >& faces,
+			 double chord_tol, double angle_tol,
+			 shared_ptr<GenericTriMesh>& mesh,
+			 std::vector<int>& failed) const;
+
   /// Return a tesselation of the control polygon of all surfaces
   /// \retval ctr_pol Tesselation of the control polygon of all surfaces.
   virtual 
@@ -913,6 +961,9 @@ class GO_API SurfaceModel : public CompositeModel
 
   ftPoint closestPointLocal(const ftPoint& point) const;
 
+  // Make a cell division of the faces
+  shared_ptr<CellDivision> createCelldiv() const;
+
   void localExtreme(ftSurface *face, Point& dir, 
 		    Point& ext_pnt, int& ext_id,
 		    double ext_par[]);
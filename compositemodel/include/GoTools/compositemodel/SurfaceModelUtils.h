@@ -57,6 +57,7 @@ namespace Go
   class BoundedSurface;
   class CurveOnSurface;
   class ftPointSet;
+  class GenericTriMesh;
 
   namespace SurfaceModelUtils
   {
@@ -145,6 +146,28 @@ namespace Go
 			 shared_ptr<GeneralMesh>& mesh,
 			 double tol2d, int n=20, int m=20);
 
+    /// Tesselate a set of surfaces, in parallel if OpenMP is enabled.
+    /// Each surface is tesselated from a private copy, so the surfaces
+    /// may share an underlying surface.
+    /// res holds the resolution in u and v for each surface. The meshes
+    /// are returned in the order of the surfaces, surfaces that fail to
+    /// tesselate are skipped.
+    void tesselateSurfaces(const std::vector<shared_ptr<ParamSurface> >& surfs,
+			   const std::vector<int>& res, double tol2d,
+			   std::vector<shared_ptr<GeneralMesh> >& meshes);
+
+    /// Tesselate a set of faces into one indexed triangle mesh. Each edge
+    /// is sampled once and the samples are shared by the faces meeting
+    /// at the edge, so the mesh has no cracks. Triangles are refined until
+    /// they deviate less than chord_tol from the surface and the surface
+    /// normals at their corners differ by less than angle_tol (radians).
+    /// Faces that cannot be tesselated are left out of the mesh, and
+    /// their indices in faces are returned in failed.
+    void tesselateAdaptive(const std::vector<shared_ptr<ftSurface> >& faces,
+			   double chord_tol, double angle_tol,
+			   shared_ptr<GenericTriMesh>& mesh,
+			   std::vector<int>& failed);
+
     void triangulateFaces(std::vector<shared_ptr<ftSurface> >& faces,
 			  shared_ptr<ftPointSet>& triang, double tol);
 
@@ -46,6 +46,8 @@
 #include "GoTools/geometry/CurveOnSurface.h"
 #include "GoTools/geometry/CurveBoundedDomain.h"
 #include "GoTools/geometry/GeometryTools.h"
+#include "GoTools/utils/DirectionCone.h"
+#include "GoTools/utils/CachedValue.h"
 #include "GoTools/utils/config.h"
 
 
@@ -204,6 +206,9 @@ public:
     /// \ref Domain (such as CurveBoundedDomain, found in the
     /// \c sisl_dependent module).
     /// \return a Domain object describing the parametric domain of the surface
+    /// \note The domain is built at the first call and kept until the
+    ///       trimming loops are modified. The returned reference is
+    ///       valid until then.
     virtual const CurveBoundedDomain& parameterDomain() const;
 
     /// Get a rectangular parameter domain that is guaranteed to contain the
@@ -539,9 +544,14 @@ public:
     int numberOfLoops() const
     { return (int)boundary_loops_.size(); }
 
-    /// Get a shared pointer to a specific boundary loop
+    /// Get a shared pointer to a specific boundary loop. The loop
+    /// may be modified through the pointer, hence the surface is
+    /// registered as modified.
     shared_ptr<CurveLoop> loop(int idx)
-      { return boundary_loops_[idx]; }
+      {
+	setModified();
+	return boundary_loops_[idx];
+      }
 
     /// Get the space-curve resulting from fixing one of the surface's
     /// parameters and moving the other along its allowed range
@@ -787,12 +797,17 @@ private:
     /// orientation
     std::vector<int> loop_fixed_;
 
-    mutable CurveBoundedDomain domain_;
+    // The parameter domain with its polygonal classifier, stamped with
+    // domainStamp() and rebuilt only when the trimming changes
+    mutable CachedValue<shared_ptr<CurveBoundedDomain> > domain_cache_;
 
     mutable int iso_trim_;
     mutable double iso_trim_tol_;
 
-    mutable BoundingBox box_;
+    // Cached data, stamped with cacheStamp()
+    mutable CachedValue<BoundingBox> box_cache_;
+    mutable CachedValue<DirectionCone> normal_cone_cache_;
+    mutable CachedValue<DirectionCone> tangent_cone_cache_[2];
 
     // The trim curves should be valid loops. Additionally the first
     // element should be the outer ccw loop, all other loops should be
@@ -853,6 +868,20 @@ private:
 
     void setParameterDomainBdLoops(double u1, double u2, 
 				   double v1, double v2);
+
+    // Stamp for the cached parameter domain. The trimming curves may
+    // be changed through shared pointers without this surface knowing,
+    // hence the stamp depends on the identity and modification count of
+    // each trimming curve and its parameter curve
+    unsigned long long domainStamp() const;
+
+    // Stamp for the cached data, combining the modification count of
+    // this surface (trimming) with that of the underlying surface
+    unsigned long long cacheStamp() const
+    {
+      return ((unsigned long long)modification_count_ << 32) | 
+	surface_->modificationCount();
+    }
 };
 
 
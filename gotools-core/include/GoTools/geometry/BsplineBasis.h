@@ -174,6 +174,9 @@ public:
 			    double resolution=1.0e-12) const; 
 
     /// Compute basis values for many points simultaneously.
+    /// The parameters may come in any order, but sorted parameters are
+    /// located in the knot vector by a single pass through it. Orders 2 to 6
+    /// are evaluated by order specific code.
     /// \param parvals_start pointer to the start of list of parameters where you 
     ///                      want to evaluate the basis functions
     /// \param parvals_end pointer to one-past-end of list of parameters where you 
@@ -286,6 +286,30 @@ private:
     // We store a set of curve loops
     std::vector<shared_ptr<CurveLoop> > loops_;
 
+    // Polygonal approximation of the loops, with a bound on the distance
+    // to the curves for each edge, sorted into a grid. Points farther
+    // from the polygon than this bound are classified by counting
+    // crossings with the polygon. Built at the first query and never
+    // changed afterwards, concurrent queries share it without locking.
+    struct Classifier;
+    mutable shared_ptr<Classifier> classifier_;
+
+    // Build the polygonal classifier. If some loop curve cannot be
+    // approximated, the classifier is marked as invalid.
+    shared_ptr<Classifier> buildClassifier() const;
+
+    // Classify a point using classifier_. Returns 1 if the point is
+    // inside the domain, 0 if it is outside and -1 if it is too close
+    // to the boundary to decide.
+    int classifyFromPolygon(const Array<double, 2>& point,
+			    double tolerance) const;
+
+    // The exact tests used when the polygon cannot decide
+    bool isInDomainExact(const Array<double, 2>& point,
+			 double tolerance) const;
+    bool isOnBoundaryExact(const Array<double, 2>& point,
+			   double tolerance) const;
+
     // We return a pointer to a parameter curve defining boundary. If loops_
     // consists of CoCurveOnSurface's, the parameter domain curve is returned.
     // Otherwise we make sure that dimension really is 2.
@@ -342,7 +342,31 @@ public:
     virtual bool isInPlane(const Point& norm,
 			   double eps, Point& pos) const;
 
+    /// Counter that is incremented each time the curve is modified.
+    /// Used to validate data that are computed on demand and cached,
+    /// like the bounding box.
+    unsigned int modificationCount() const
+    {
+      return modification_count_;
+    }
+
+    /// Register that the curve is modified. Called by all member
+    /// functions changing the curve. Must be called after writing
+    /// coefficients or knots through a non-const iterator or reference.
+    void setModified()
+    {
+      ++modification_count_;
+    }
+
 protected:
+    // Starts at one, cached data stamped with zero are never valid
+    unsigned int modification_count_;
+
+    ParamCurve()
+      : modification_count_(1)
+    {
+    }
+
     void closestPointGeneric(const Point&   pt,
 			     double    tmin,
 			     double    tmax,
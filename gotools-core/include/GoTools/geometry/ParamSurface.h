@@ -565,6 +565,22 @@ public:
       return false;
     }
 
+    /// Counter that is incremented each time the surface is modified.
+    /// Used to validate data that are computed on demand and cached,
+    /// like the bounding box.
+    unsigned int modificationCount() const
+    {
+      return modification_count_;
+    }
+
+    /// Register that the surface is modified. Called by all member
+    /// functions changing the surface. Must be called after writing
+    /// coefficients or knots through a non-const iterator or reference.
+    void setModified()
+    {
+      ++modification_count_;
+    }
+
  protected:
     /// Degeneracy information regarding one boundary surface of the current surface
     struct degenerate_info
@@ -589,9 +605,12 @@ public:
 
     IteratorType iterator_;
 
+    // Starts at one, cached data stamped with zero are never valid
+    unsigned int modification_count_;
+
     ParamSurface()
       : est_sf_size_u_(0.0), est_sf_size_v_(0.0), nmb_size_u_(-1), 
-      nmb_size_v_(-1), iterator_(Iterator_parametric)
+      nmb_size_v_(-1), iterator_(Iterator_parametric), modification_count_(1)
 	{
 	}
 
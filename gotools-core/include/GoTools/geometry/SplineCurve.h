@@ -42,6 +42,7 @@
 
 
 #include "GoTools/utils/DirectionCone.h"
+#include "GoTools/utils/CachedValue.h"
 #include "GoTools/geometry/ParamCurve.h"
 #include "GoTools/geometry/BsplineBasis.h"
 #include "GoTools/utils/config.h"
@@ -362,6 +363,7 @@ public:
 
     /// Get a reference to the BsplineBasis of the curve
     /// \return reference to the curve's BsplineBasis.
+    /// \note Call setModified() after changes made through the result.
     BsplineBasis& basis()
     { return basis_; }
 
@@ -388,10 +390,12 @@ public:
 
     /// Get an iterator to the beginning of the knot vector
     /// \return an iterator to the beginning of the knot vector
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator knotsBegin()
     { return basis_.begin(); }
     /// Get a one-past-end iterator to the knot vector
     /// \return an iterator to one-past-end of the knot vector
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator knotsEnd()
     { return basis_.end(); }
     /// Get a const iterator to the beginning of the knot vector
@@ -408,12 +412,14 @@ public:
     /// non-rational control point array
     /// \return an iterator to the start of the curves non-rational
     /// control point array
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator coefs_begin() 
     { return coefs_.begin(); }
     /// Get a one-past-end iterator to the curve's non-rational,
     /// internal control point array
     /// \return an iterator to one-past-end of the curve's
     /// non-rational, internal control point array
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator coefs_end() 
     { return coefs_.end(); }
     /// Get a const iterator to the start of the curve's non-rational,
@@ -432,12 +438,14 @@ public:
     /// control point array
     /// \return an iterator to the start of the curves rational
     /// control point array
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator rcoefs_begin() 
     { return rcoefs_.begin(); }
     /// Get a one-past-end iterator to the curve's rational, internal
     /// control point array
     /// \return an iterator to one-past-end of the curve's rational,
     /// internal control point array
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator rcoefs_end() 
     { return rcoefs_.end(); }
     /// Get a const iterator to the start of the curve's rational,
@@ -624,6 +632,10 @@ private:
     std::vector<double> rcoefs_;  /// Like rcoef in SISL, only used if
 				  /// rational
 
+    // Cached data, stamped with the modification count
+    mutable CachedValue<BoundingBox> box_cache_;
+    mutable CachedValue<DirectionCone> cone_cache_;
+
     // Data about origin or history
     bool is_elementary_curve_;
     shared_ptr<ElementaryCurve> elementary_curve_;
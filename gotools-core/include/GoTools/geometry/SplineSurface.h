@@ -45,6 +45,8 @@
 #include "GoTools/geometry/BsplineBasis.h"
 #include "GoTools/geometry/RectDomain.h"
 #include "GoTools/utils/ScratchVect.h"
+#include "GoTools/utils/DirectionCone.h"
+#include "GoTools/utils/CachedValue.h"
 #include "GoTools/utils/config.h"
 
 namespace Go
@@ -52,8 +54,8 @@ namespace Go
 
 class Interpolator;
 class SplineCurve;
-class DirectionCone;
 class ElementarySurface;
+class SplineSurfaceProjector;
 
 /// Structure for storage of results of grid evaluation of the basis function of a spline surface.
 /// Positional evaluation information in one parameter value
@@ -262,7 +264,8 @@ class GO_API SplineSurface : public ParamSurface
     /// Creates an uninitialized SplineSurface, which can only be assigned to 
     /// or read(...) into.
     SplineSurface()
-      : ParamSurface(), dim_(-1), rational_(false), is_elementary_surface_(false)
+      : ParamSurface(), dim_(-1), rational_(false),
+	projector_seeding_(false), is_elementary_surface_(false)
     {
     }
 
@@ -304,7 +307,7 @@ class GO_API SplineSurface : public ParamSurface
 	: ParamSurface(), dim_(dim), rational_(rational),
         basis_u_(number1, order1, knot1start),
         basis_v_(number2, order2, knot2start), 
-        is_elementary_surface_(false)
+        projector_seeding_(false), is_elementary_surface_(false)
     {
 	if (rational) {
 	    int n = (dim+1)*number1*number2;
@@ -344,7 +347,7 @@ class GO_API SplineSurface : public ParamSurface
 	: ParamSurface(), dim_(dim), rational_(rational),
         basis_u_(basis_u),
         basis_v_(basis_v),
-        is_elementary_surface_(false)
+        projector_seeding_(false), is_elementary_surface_(false)
     {
 	int number1 = basis_u.numCoefs();
 	int number2 = basis_v.numCoefs();
@@ -572,6 +575,20 @@ class GO_API SplineSurface : public ParamSurface
 			      const RectDomain* domain_of_interest = NULL,
 			      double   *seed = 0) const;
 
+    /// Find the start point of closestPoint(), when no seed is given,
+    /// from a bounding box hierarchy over the Bezier patches instead of
+    /// a search through the control grid, see SplineSurfaceProjector.
+    /// Pays off when many points are projected onto the same surface.
+    /// The hierarchy is built at the first query and rebuilt after the
+    /// surface is modified. Off by default.
+    void setProjectorSeeding(bool use_projector)
+    { projector_seeding_ = use_projector; }
+
+    /// Check if closestPoint() finds its start point through a
+    /// SplineSurfaceProjector
+    bool projectorSeeding() const
+    { return projector_seeding_; }
+
     // inherited from ParamSurface
     virtual void closestBoundaryPoint(const Point& pt,
 				      double&        clo_u,
@@ -745,11 +762,13 @@ class GO_API SplineSurface : public ParamSurface
 
     /// get a reference to the BsplineBasis for the first parameter
     /// \return reference to the BsplineBasis for the first parameter
+    /// \note Call setModified() after changes made through the result.
     BsplineBasis& basis_u()
     { return basis_u_; }
 
     /// get a reference to the BsplineBasis for the second parameter
     /// \return reference to the BsplineBasis for the second parameter
+    /// \note Call setModified() after changes made through the result.
     BsplineBasis& basis_v()
     { return basis_v_; }
 
@@ -803,6 +822,7 @@ class GO_API SplineSurface : public ParamSurface
     /// points.
     /// \return an (nonconst) iterator to the start of the internal array of non-
     ///         rational control points
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator coefs_begin()
     { return coefs_.begin(); }
 
@@ -810,6 +830,7 @@ class GO_API SplineSurface : public ParamSurface
     /// rational control points
     /// \return an (nonconst) iterator to the one-past-end position of the internal
     ///         array of non-rational control points
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator coefs_end()
     { return coefs_.end(); }
 
@@ -831,6 +852,7 @@ class GO_API SplineSurface : public ParamSurface
     /// points.
     /// \return an (nonconst) iterator ro the start of the internal array of rational
     ///         control points.
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator rcoefs_begin()
     { return rcoefs_.begin(); }
 
@@ -838,6 +860,7 @@ class GO_API SplineSurface : public ParamSurface
     /// \em rational control points.
     /// \return an (nonconst) iterator to the start of the internal array of rational
     ///         control points.
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator rcoefs_end()
     { return rcoefs_.end(); }
 
@@ -859,6 +882,7 @@ class GO_API SplineSurface : public ParamSurface
     /// points.
     /// \return an (nonconst) iterator to the start of the internal array of 
     ///         rational or non-rational control points
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator ctrl_begin()
     { return rational_ ? rcoefs_.begin() : coefs_.begin(); }
 
@@ -866,6 +890,7 @@ class GO_API SplineSurface : public ParamSurface
     /// active control points
     /// \return an (nonconst) iterator to the one-past-end position of the internal
     ///         array of rational or non-rational control points
+    /// \note Call setModified() after changes made through the result.
     std::vector<double>::iterator ctrl_end()
     { return rational_ ? rcoefs_.end() : coefs_.end(); }
 
@@ -1474,6 +1499,12 @@ class GO_API SplineSurface : public ParamSurface
     // Generated data
     mutable RectDomain domain_;
     mutable CurveLoop spatial_boundary_;
+    // Cached data, stamped with the modification count
+    mutable CachedValue<BoundingBox> box_cache_;
+    mutable CachedValue<DirectionCone> normal_cone_cache_;
+    mutable CachedValue<DirectionCone> tangent_cone_cache_[2];
+    bool projector_seeding_;
+    mutable CachedValue<shared_ptr<SplineSurfaceProjector> > projector_cache_;
 
     // Data about origin or history
     bool is_elementary_surface_;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPLINESURFACEPROJECTOR_H
+#define _SPLINESURFACEPROJECTOR_H
+
+#include "GoTools/geometry/SplineSurface.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Closest point computation for many points with respect to one
+/// SplineSurface. A bounding box hierarchy over the Bezier patches of
+/// the surface, where each box is given by the control polygon of the
+/// patch, gives start parameters for SplineSurface::closestPoint in
+/// logarithmic time instead of a search through the entire control grid.
+/// The hierarchy is built at the first query. The surface is not copied
+/// and must not be modified while the projector is in use.
+class GO_API SplineSurfaceProjector
+{
+public:
+    /// Constructor.
+    /// \param surf the surface to project onto
+    /// \param nmb_samples the number of surface points in each parameter
+    ///        direction of each Bezier patch used to estimate the distance
+    SplineSurfaceProjector(shared_ptr<SplineSurface> surf,
+			   int nmb_samples = 3);
+
+    /// Destructor
+    ~SplineSurfaceProjector();
+
+    /// The surface
+    shared_ptr<SplineSurface> surface() const
+    { return surf_; }
+
+    /// Build the box hierarchy if it does not exist already. Called by
+    /// the query functions.
+    void build();
+
+    /// Find start parameters for closest point iteration, the parameter
+    /// of the nearest sample point on the surface.
+    /// \param pt the point to project
+    /// \param seed_u first start parameter
+    /// \param seed_v second start parameter
+    /// \param rd if given, the seed is restricted to this domain
+    void seed(const Point& pt, double& seed_u, double& seed_v,
+	      const RectDomain* rd = NULL);
+
+    /// Closest point on the surface, see SplineSurface::closestPoint.
+    void closestPoint(const Point& pt, double& clo_u, double& clo_v,
+		      Point& clo_pt, double& clo_dist, double epsilon,
+		      const RectDomain* rd = NULL);
+
+    /// Closest points for a set of points. The computation is run in
+    /// parallel if OpenMP is enabled, using one copy of the surface
+    /// for each thread.
+    /// \param points the points, stored consecutively
+    /// \param epsilon geometric tolerance
+    /// \param clo_par parameter values of the closest points, two for
+    ///        each point
+    /// \param clo_dist distances to the closest points
+    void closestPoints(const std::vector<double>& points, double epsilon,
+		       std::vector<double>& clo_par,
+		       std::vector<double>& clo_dist);
+
+private:
+    struct BoxNode
+    {
+	int patch;           // Patch index for leaves, -1 otherwise
+	int child[2];
+	double umin, umax, vmin, vmax;
+    };
+
+    shared_ptr<SplineSurface> surf_;
+    int dim_;
+    int nmb_samples_;
+
+    // Knot intervals of the Bezier patches
+    std::vector<double> knots_u_;
+    std::vector<double> knots_v_;
+
+    // Bounding boxes of nodes, low and high corners, dim_ entries each
+    std::vector<BoxNode> nodes_;
+    std::vector<double> box_low_;
+    std::vector<double> box_high_;
+
+    // Surface points, nmb_samples_*nmb_samples_ for each patch
+    std::vector<double> samples_;
+
+    int buildNode(int i1, int i2, int j1, int j2);
+    void seedImpl(const double* pt, const RectDomain* rd,
+		  double& seed_u, double& seed_v) const;
+};
+
+} // namespace Go
+
+#endif // _SPLINESURFACEPROJECTOR_H
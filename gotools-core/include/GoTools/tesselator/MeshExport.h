@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _MESHEXPORT_H
+#define _MESHEXPORT_H
+
+
+#include "GoTools/tesselator/GeneralMesh.h"
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <iostream>
+
+namespace Go {
+
+/// Merging of meshes and export of triangle meshes to file formats
+/// used by other tools
+namespace MeshExport
+{
+  /// Merge a set of meshes, typically one mesh for each face of a model,
+  /// into one indexed triangle mesh. Vertices closer than tol are welded
+  /// to one vertex, found by hashing the vertices in a grid of cell size
+  /// tol. Triangles that degenerate in the welding are removed. The
+  /// normals of welded vertices are averaged, and vertices on edges
+  /// belonging to only one triangle are flagged as boundary vertices.
+  /// Meshes without triangles (e.g. line strips) are ignored.
+  shared_ptr<GenericTriMesh>
+    weldMeshes(const std::vector<shared_ptr<GeneralMesh> >& meshes,
+	       double tol);
+
+  /// Write a triangle mesh as binary STL (little endian, single precision)
+  void writeBinarySTL(std::ostream& os, GenericTriMesh& mesh);
+
+  /// Write a triangle mesh as binary little endian PLY. Vertex normals
+  /// are included if the mesh has normals.
+  void writeBinaryPLY(std::ostream& os, GenericTriMesh& mesh);
+
+  /// Write a triangle mesh as Wavefront OBJ. Vertex normals are included
+  /// if the mesh has normals.
+  void writeOBJ(std::ostream& os, GenericTriMesh& mesh);
+
+}  // of namespace MeshExport
+}; // end namespace Go
+#endif // _MESHEXPORT_H
@@ -43,8 +43,10 @@
 #include "GoTools/tesselator/Tesselator.h"
 #include "GoTools/tesselator/RegularMesh.h"
 #include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/geometry/ParamCurve.h"
 #include "GoTools/tesselator/GenericTriMesh.h"
 #include <memory>
+#include <vector>
 #include "GoTools/utils/config.h"
 
 namespace Go
@@ -60,7 +62,8 @@ public:
   /// Constructor. Surface and mesh size are given. The mesh size relates to 
   /// the underlying surface in the case of bounded surfaces.
     ParametricSurfaceTesselator(const ParamSurface& surf)
-	: surf_(surf), m_(20), n_(20)
+	: surf_(surf), m_(20), n_(20), rectangular_domain_(false), umin_(0.0), umax_(0.0), vmin_(0.0),
+	  vmax_(0.0)
     {
  	mesh_ = shared_ptr<GenericTriMesh>(new GenericTriMesh(0,0,true,true));
     }
@@ -80,7 +83,11 @@ public:
 	return mesh_;
     }
 
-    /// Change mesh size
+    /// Change mesh size. The trimming information extracted from the
+    /// surface in the first tesselation is reused. For a rectangular
+    /// domain, vertices on grid lines kept from the current mesh are
+    /// copied rather than evaluated, e.g. all old vertices when going
+    /// from n to 2n-1.
     void changeRes(int n, int m);
 
     /// Fetch info about mesh size
@@ -96,6 +103,25 @@ private:
     int m_;
     int n_;
 
+    // Information about the surface domain and the parameter domain
+    // trimming curves. Independent of the mesh size, computed once and
+    // recomputed when the surface is modified. prepared_count_ holds the
+    // modification counts of the surface and its underlying surfaces
+    // when the information was computed, empty if not computed.
+    std::vector<unsigned int> prepared_count_;
+    bool rectangular_domain_;
+    double umin_, umax_, vmin_, vmax_;
+    shared_ptr<ParamSurface> under_sf_;
+    std::vector<shared_ptr<ParamCurve> > par_cv_;
+
+    void prepare();
+
+    std::vector<unsigned int> modificationCounts() const;
+
+    // Evaluate the grid for a rectangular domain, copying vertices on
+    // grid lines shared with the current old_n x old_m mesh
+    void tesselateRectangular(int old_n, int old_m);
+
 };
 
 } // namespace Go
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _CACHESTATISTICS_H
+#define _CACHESTATISTICS_H
+
+#include "GoTools/utils/config.h"
+#include <atomic>
+#include <iostream>
+
+namespace Go
+{
+
+    /** Hit and miss counters for the lazily computed data cached in
+     *  geometry objects, like bounding boxes and direction cones.
+     *  Counting is switched off by default, and enabled with
+     *  CacheStatistics::enable(). The counters are shared by all
+     *  threads.
+     */
+
+class GO_API CacheStatistics
+{
+public:
+    /// The kind of cached data
+    enum CacheType
+    {
+	BoundingBoxCache = 0,
+	DirectionConeCache,
+	ParameterDomainCache,
+	ProjectorCache,
+	NumCacheTypes
+    };
+
+    /// Switch counting on or off
+    static void enable(bool on = true)
+    { enabled_.store(on, std::memory_order_relaxed); }
+
+    /// Whether counting is switched on
+    static bool enabled()
+    { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Register that cached data was reused
+    static void hit(CacheType type)
+    {
+	if (enabled())
+	    hits_[type].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Register that data had to be (re)computed
+    static void miss(CacheType type)
+    {
+	if (enabled())
+	    misses_[type].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Number of registered hits
+    static unsigned long hits(CacheType type)
+    { return hits_[type].load(); }
+
+    /// Number of registered misses
+    static unsigned long misses(CacheType type)
+    { return misses_[type].load(); }
+
+    /// Fraction of the queries that were served from the cache, or
+    /// zero if no queries are registered
+    static double hitRate(CacheType type);
+
+    /// Set all counters to zero
+    static void reset();
+
+    /// Write the counters of all cache types to a stream
+    static void write(std::ostream& os);
+
+private:
+    static std::atomic<bool> enabled_;
+    static std::atomic<unsigned long> hits_[NumCacheTypes];
+    static std::atomic<unsigned long> misses_[NumCacheTypes];
+};
+
+
+} // namespace Go
+
+#endif // _CACHESTATISTICS_H
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _CACHEDVALUE_H
+#define _CACHEDVALUE_H
+
+#include "GoTools/utils/CacheStatistics.h"
+#include <mutex>
+
+namespace Go
+{
+
+    /** A value that is computed on demand and kept until the object
+     *  it is computed from is modified. The value is stamped with the
+     *  modification count of the owner at the time of computation, and
+     *  is valid as long as the owner reports the same count. Stamp zero
+     *  is never valid.
+     *  The cache may be queried and filled from several threads at the
+     *  same time, for instance from const member functions of a shared
+     *  object. If several threads compute the value, the first one
+     *  stored is kept and returned to all of them. Modifying the owner
+     *  concurrently with queries is not supported.
+     */
+
+template <typename T>
+class CachedValue
+{
+public:
+    /// The default constructor makes an invalid cache
+    CachedValue()
+	: stamp_(0)
+    {}
+
+    /// Copy constructor. The lock is not copied
+    CachedValue(const CachedValue& other)
+    {
+	std::lock_guard<std::mutex> lock(other.mutex_);
+	value_ = other.value_;
+	stamp_ = other.stamp_;
+    }
+
+    /// Assignment operator. The lock is not copied
+    CachedValue& operator=(const CachedValue& other)
+    {
+	if (this != &other)
+	{
+	    T value;
+	    unsigned long long stamp;
+	    {
+		std::lock_guard<std::mutex> lock(other.mutex_);
+		value = other.value_;
+		stamp = other.stamp_;
+	    }
+	    std::lock_guard<std::mutex> lock(mutex_);
+	    value_ = value;
+	    stamp_ = stamp;
+	}
+	return *this;
+    }
+
+    /// Fetch the value if it is computed for the given stamp, and
+    /// register the outcome in CacheStatistics
+    bool get(unsigned long long stamp, CacheStatistics::CacheType type,
+	     T& value) const
+    {
+	bool is_valid;
+	{
+	    std::lock_guard<std::mutex> lock(mutex_);
+	    is_valid = (stamp_ == stamp && stamp_ != 0);
+	    if (is_valid)
+		value = value_;
+	}
+	if (is_valid)
+	    CacheStatistics::hit(type);
+	else
+	    CacheStatistics::miss(type);
+	return is_valid;
+    }
+
+    /// Store a value computed for the given stamp, unless another
+    /// thread already stored one. Returns the stored value
+    T set(const T& value, unsigned long long stamp)
+    {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (stamp_ != stamp)
+	{
+	    value_ = value;
+	    stamp_ = stamp;
+	}
+	return value_;
+    }
+
+    /// Forget the cached value
+    void invalidate()
+    {
+	std::lock_guard<std::mutex> lock(mutex_);
+	stamp_ = 0;
+    }
+
+private:
+    T value_;
+    unsigned long long stamp_;
+    mutable std::mutex mutex_;
+};
+
+
+} // namespace Go
+
+#endif // _CACHEDVALUE_H
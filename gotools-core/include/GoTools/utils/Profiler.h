@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include "GoTools/utils/config.h"
+#include <chrono>
+#include <iostream>
+
+namespace Go
+{
+
+    /** Lightweight instrumentation of time consuming functions. Named
+     *  entries collect the number of calls and the time spent in timed
+     *  scopes, sums of counters and maxima of registered values. Each
+     *  thread accumulates into its own storage, and the entries are
+     *  summed over all threads when they are written.
+     *
+     *  Code is instrumented through the macros GO_PROFILE_SCOPE,
+     *  GO_PROFILE_SCOPE_IF, GO_PROFILE_COUNT and GO_PROFILE_MAX. They expand
+     *  to nothing unless GoTools is compiled with GOTOOLS_PROFILE defined
+     *  (the CMake option GoTools_ENABLE_PROFILING), so instrumentation has
+     *  no cost in a normal build. If the environment variable
+     *  GOTOOLS_PROFILE_OUTPUT names a file when the program exits, the
+     *  entries are written to that file in JSON format.
+     */
+
+class GO_API Profiler
+{
+public:
+    /// Register a named entry and return its identifier. Registering
+    /// the same name several times gives the same identifier, so entries
+    /// may be shared between several places in the code.
+    static int registerEntry(const char* name);
+
+    /// Add one call of the given duration to an entry
+    static void addTime(int id, long long nanoseconds);
+
+    /// Add to the counter of an entry
+    static void addCount(int id, long long count);
+
+    /// Register a value, keeping the largest value of an entry
+    static void addMax(int id, long long value);
+
+    /// Clear all entries in all threads
+    static void reset();
+
+    /// Write all entries, summed over the threads, as a JSON object.
+    /// Should not be called while instrumented code runs in other
+    /// threads.
+    static void writeJSON(std::ostream& os);
+
+    /// Timer that adds the lifetime of the object to an entry
+    class ScopedTimer
+    {
+    public:
+	explicit ScopedTimer(int id, bool active = true)
+	    : id_(active ? id : -1)
+	{
+	    if (id_ >= 0)
+		start_ = std::chrono::steady_clock::now();
+	}
+
+	~ScopedTimer()
+	{
+	    if (id_ >= 0)
+		addTime(id_, std::chrono::duration_cast<std::chrono::nanoseconds>
+			(std::chrono::steady_clock::now() - start_).count());
+	}
+
+    private:
+	int id_;
+	std::chrono::steady_clock::time_point start_;
+
+	ScopedTimer(const ScopedTimer&);
+	ScopedTimer& operator=(const ScopedTimer&);
+    };
+};
+
+
+} // namespace Go
+
+
+#define GO_PROFILE_CONCAT_(a, b) a##b
+#define GO_PROFILE_CONCAT(a, b) GO_PROFILE_CONCAT_(a, b)
+#define GO_PROFILE_ID(name)						\
+    static const int GO_PROFILE_CONCAT(go_profile_id_, __LINE__) =	\
+	Go::Profiler::registerEntry(name)
+
+#ifdef GOTOOLS_PROFILE
+
+/// Time the rest of the enclosing scope
+#define GO_PROFILE_SCOPE(name) GO_PROFILE_SCOPE_IF(name, true)
+
+/// Time the rest of the enclosing scope if cond is true, for instance
+/// only at the top level of a recursion
+#define GO_PROFILE_SCOPE_IF(name, cond)					\
+    GO_PROFILE_ID(name);						\
+    Go::Profiler::ScopedTimer GO_PROFILE_CONCAT(go_profile_timer_, __LINE__) \
+    (GO_PROFILE_CONCAT(go_profile_id_, __LINE__), (cond))
+
+/// Add count to a counter
+#define GO_PROFILE_COUNT(name, count)					\
+    do {								\
+	GO_PROFILE_ID(name);						\
+	Go::Profiler::addCount(GO_PROFILE_CONCAT(go_profile_id_, __LINE__), \
+			       (count));				\
+    } while (0)
+
+/// Keep the largest of the registered values
+#define GO_PROFILE_MAX(name, value)					\
+    do {								\
+	GO_PROFILE_ID(name);						\
+	Go::Profiler::addMax(GO_PROFILE_CONCAT(go_profile_id_, __LINE__), \
+			     (value));					\
+    } while (0)
+
+#else // GOTOOLS_PROFILE
+
+#define GO_PROFILE_SCOPE(name)
+#define GO_PROFILE_SCOPE_IF(name, cond)
+#define GO_PROFILE_COUNT(name, count) do {} while (0)
+#define GO_PROFILE_MAX(name, value) do {} while (0)
+
+#endif // GOTOOLS_PROFILE
+
+#endif // _PROFILER_H
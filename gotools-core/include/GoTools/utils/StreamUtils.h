@@ -42,6 +42,7 @@
 
 #include <iostream>
 #include <vector>
+#include <limits>
 
 namespace { // anonymous, local namespace
   const char separator = ' ';
@@ -111,4 +112,110 @@ void object_from_stream(std::wistream& is, std::vector<T>& v)
 
 
 
+// =============================================================================
+// Binary streaming. The data are written in the byte order of the machine,
+// the reader is responsible for checking that it matches.
+// =============================================================================
+
+// =============================================================================
+// Write an array of plain data objects as raw bytes
+template<typename T>
+void raw_to_stream(std::ostream& os, const T* data, size_t num)
+// =============================================================================
+{
+  if (num > 0)
+    os.write(reinterpret_cast<const char*>(data), num*sizeof(T));
+}
+
+// =============================================================================
+// Read an array of plain data objects written by raw_to_stream()
+template<typename T>
+void raw_from_stream(std::istream& is, T* data, size_t num)
+// =============================================================================
+{
+  if (num > 0)
+    is.read(reinterpret_cast<char*>(data), num*sizeof(T));
+}
+
+// =============================================================================
+// Number of bytes left to read from the stream. Used for checking sizes
+// read from a stream before allocating. Returns the largest size_t value
+// if the stream is not seekable.
+inline size_t stream_bytes_left(std::istream& is)
+// =============================================================================
+{
+  if (!is)
+    return 0;
+  const std::istream::pos_type pos = is.tellg();
+  if (pos == std::istream::pos_type(-1))
+    return std::numeric_limits<size_t>::max();
+  is.seekg(0, std::ios::end);
+  const std::istream::pos_type end = is.tellg();
+  is.clear();
+  is.seekg(pos);
+  if (end == std::istream::pos_type(-1))
+    return std::numeric_limits<size_t>::max();
+  return (end > pos) ? (size_t)(end - pos) : 0;
+}
+
+// =============================================================================
+// Write a non-negative integer using a variable number of bytes, 7 bits
+// in each. Small values, like differences between sorted indices, take
+// one byte.
+inline void varint_to_stream(std::ostream& os, unsigned long long val)
+// =============================================================================
+{
+  char buf[10];
+  int nmb = 0;
+  while (val >= 0x80)
+    {
+      buf[nmb++] = (char)((val & 0x7f) | 0x80);
+      val >>= 7;
+    }
+  buf[nmb++] = (char)val;
+  os.write(buf, nmb);
+}
+
+// =============================================================================
+// Read an integer written by varint_to_stream()
+inline unsigned long long varint_from_stream(std::istream& is)
+// =============================================================================
+{
+  unsigned long long val = 0;
+  int shift = 0;
+  std::istream::int_type byte;
+  while ((byte = is.get()) != std::istream::traits_type::eof())
+    {
+      val |= (unsigned long long)(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+	break;
+      shift += 7;
+      if (shift >= 64)
+	{
+	  is.setstate(std::ios::failbit);
+	  break;
+	}
+    }
+  return val;
+}
+
+// =============================================================================
+// Signed integers are mapped to non-negative ones (0, -1, 1, -2, ... maps to
+// 0, 1, 2, 3, ...) before variable length encoding
+inline void signed_varint_to_stream(std::ostream& os, long long val)
+// =============================================================================
+{
+  varint_to_stream(os, (val < 0) ? 2*(unsigned long long)(-(val+1)) + 1 :
+		   2*(unsigned long long)val);
+}
+
+// =============================================================================
+inline long long signed_varint_from_stream(std::istream& is)
+// =============================================================================
+{
+  unsigned long long val = varint_from_stream(is);
+  return (val & 1) ? -(long long)(val >> 1) - 1 : (long long)(val >> 1);
+}
+
+
 #endif
@@ -322,9 +322,12 @@ private:
 
     // Utility members
 
-    bool readSingleIGESLine(std::istream& is, char line_terminated[81],
+    /// Read the next line from the memory buffer [pos, end) and advance
+    /// pos past it.
+    bool readSingleIGESLine(ccp& pos, ccp end, char line_terminated[81],
 			    int& line_number, IGESSection& sect);
-    void writeSingleIGESLine(std::ostream& os, const char line_terminated[73],
+    /// Append one 80 column line and a newline to out.
+    void writeSingleIGESLine(std::string& out, const char line_terminated[73],
 			     int line_number, IGESSection sect);
     /// If whereami is within the P section, it gives the current line
     /// number.
@@ -257,6 +257,8 @@ public:
 	void removeSupportFunction(LRBSpline2D *f);
 	void addSupportFunction(LRBSpline2D *f);
 	bool hasSupportFunction(LRBSpline2D *f);
+	/// Replace the supporting B-splines. No check for duplicates
+	void setSupportFunctions(const std::vector<LRBSpline2D*>& functions);
 	Element2D *split(bool split_u, double par_value);
 	Element2D* copy();
 	// get/set methods
@@ -286,10 +288,10 @@ public:
 
 	LRBSpline2D* supportFunction(int i) { return support_[i];   };
 	int nmbBasisFunctions() const       { return (int)support_.size(); };
-	void setUmin(double u)                           { start_u_ = u; };
-	void setVmin(double v)                           { start_v_ = v; };
-	void setUmax(double u)                           { stop_u_  = u; };
-	void setVmax(double v)                           { stop_v_  = v; };
+	void setUmin(double u)                           { start_u_ = u; bezier_coefs_.clear(); accuracy_outdated_ = true; };
+	void setVmin(double v)                           { start_v_ = v; bezier_coefs_.clear(); accuracy_outdated_ = true; };
+	void setUmax(double u)                           { stop_u_  = u; bezier_coefs_.clear(); accuracy_outdated_ = true; };
+	void setVmax(double v)                           { stop_v_  = v; bezier_coefs_.clear(); accuracy_outdated_ = true; };
 
 	bool isOverloaded() const;
 	void resetOverloadCount()    { overloadCount_ = 0;      }
@@ -326,6 +328,7 @@ public:
 	{
 	  if (LSdata_.get())
 	    LSdata_->eraseDataPoints();
+	  accuracy_outdated_ = true;
 	}
 
 	void eraseDataPoints(std::vector<double>::iterator start, 
@@ -333,6 +336,7 @@ public:
 	{
 	  if (LSdata_.get())
 	    LSdata_->eraseDataPoints(start, end);
+	  accuracy_outdated_ = true;
 	}
 
 	void eraseGhostPoints()
@@ -349,6 +353,7 @@ public:
 	  if (!LSdata_)
 	    LSdata_ = shared_ptr<LSSmoothData>(new LSSmoothData());
 	  LSdata_->addDataPoints(start, end, sort_in_u);
+	  accuracy_outdated_ = true;
 	}
 	void addDataPoints(std::vector<double>::iterator start, 
 			   std::vector<double>::iterator end,
@@ -357,6 +362,7 @@ public:
 	  if (!LSdata_)
 	    LSdata_ = shared_ptr<LSSmoothData>(new LSSmoothData());
 	  LSdata_->addDataPoints(start, end, del, sort_in_u);
+	  accuracy_outdated_ = true;
 	}
 
 
@@ -533,6 +539,21 @@ public:
 	  is_modified_ = true;
 	}
 
+	/// Check if the surface or the data points in the element have
+	/// changed since the accuracy information was computed. Contrary to
+	/// isModified(), this flag is not reset by the least squares
+	/// approximation
+	bool accuracyOutdated() const
+	{
+	  return accuracy_outdated_;
+	}
+
+	/// Mark the accuracy information in the element as up to date
+	void setAccuracyUpdated()
+	{
+	  accuracy_outdated_ = false;
+	}
+
 	// DEBUG
 	double sumOfScaledBsplines(double upar, double vpar);
 
@@ -550,6 +571,48 @@ public:
 	/// \return    The spline curve
 	SplineCurve* curveOnElement(double start_u, double start_v, double end_u, double end_v) const;
 
+	/// Check if the Bezier coefficients of the surface restricted to
+	/// this element are computed
+	bool hasBezierCoefs() const
+	{
+	  return (bezier_coefs_.size() > 0);
+	}
+
+	/// Compute the Bezier coefficients of the surface restricted to this
+	/// element, expressed by the Bernstein basis after sending the element
+	/// to the unit square. The coefficients are kept until the support of
+	/// the element, the element itself or the coefficients of a supporting
+	/// B-spline change
+	void setBezierCoefs();
+
+	/// Remove the Bezier coefficients. Called when the coefficients of
+	/// a supporting B-spline change, thus the accuracy information is
+	/// also outdated
+	void eraseBezierCoefs()
+	{
+	  bezier_coefs_.clear();
+	  accuracy_outdated_ = true;
+	}
+
+	/// Fetch the Bezier coefficients, (degree_u+1)*(degree_v+1) control
+	/// points with the u-index running fastest. In the rational case the
+	/// coefficients are homogeneous with the weight stored last
+	const std::vector<double>& getBezierCoefs() const
+	{
+	  return bezier_coefs_;
+	}
+
+	/// Evaluate position and derivatives of the surface in a parameter
+	/// value in this element, using the Bezier coefficients. These must
+	/// be computed in advance.
+	/// \param upar first parameter value
+	/// \param vpar second parameter value
+	/// \param derivs number of derivatives to compute
+	/// \param res (out) position followed by derivatives in the sequence
+	///        (u, v, uu, uv, vv, ...), the dimension of the surface
+	///        entries for each. Must have room for all entries
+	void evalBezier(double upar, double vpar, int derivs, double res[]) const;
+
 
 private:
 	double start_u_;
@@ -563,10 +626,21 @@ private:
 
 	bool is_modified_;
 
+	// The surface or the data points are changed since the accuracy
+	// information was last computed
+	bool accuracy_outdated_;
+
 	// Information used in the context of least squares approximation
 	// with smoothing
 	mutable shared_ptr<LSSmoothData> LSdata_;
 
+	// The surface restricted to this element on Bezier form, see
+	// setBezierCoefs()
+	std::vector<double> bezier_coefs_;
+	int bezier_deg_[2];
+	int bezier_dim_;
+	bool bezier_rational_;
+
 	// Get the evaluations of the Bernstein functions up to given degree.
 	// The evaluation of the j-th Bernstein function of degree i will be
 	// stored as result[i][j] where 0 <= j <= i <= degree
@@ -85,6 +85,40 @@ namespace Go
 			   double& avdist_out, int& nmb_out,
 			   int mba=1, int tomba=0);
 
+    /// Approximate a large point cloud by a regular grid of nmb_u x nmb_v
+    /// LR B-spline surfaces (tiles) covering domain. The points are given
+    /// as (x, y, height) and the tiles are 1D surfaces. The points are not
+    /// altered.
+    /// Each tile is approximated by pointCloud2Spline from the points in
+    /// the tile domain extended by the fraction 'overlap' (at most 0.5) of
+    /// the tile size. The initial knot lines are placed at the tile
+    /// boundaries. The tiles are computed in parallel if OpenMP is enabled,
+    /// and only the points of the tiles being processed are copied.
+    /// Afterwards the tiles are restricted to the tile domains and stitched
+    /// with LRSurfStitch to continuity cont (0 or 1).
+    /// Tiles are organized from bottom to top and from left to right, and
+    /// tiles without points are not created. The accuracy information is
+    /// computed for the stitched tiles where each point is counted once.
+    void pointCloud2SplineTiled(const std::vector<double>& points,
+				double domain[], int nmb_u, int nmb_v,
+				double overlap, double eps, int max_iter,
+				int cont,
+				std::vector<shared_ptr<LRSplineSurface> >& tiles,
+				double& maxdist, double& avdist,
+				double& avdist_out, int& nmb_out,
+				int mba=0, int initmba=1, int tomba=5);
+
+    /// Represent a complete regular grid of stitched tiles, for instance
+    /// as computed by pointCloud2SplineTiled, as one LR B-spline surface.
+    /// The tile boundaries become knot lines of multiplicity equal to the
+    /// degree, and the coefficients are copied from the corresponding
+    /// B-splines in the tiles. Thus, the merged surface coincides with
+    /// the tiles. Throws if a tile is missing or if the spline spaces of
+    /// adjacent tiles do not match.
+    void mergeTiles(std::vector<shared_ptr<LRSplineSurface> >& tiles,
+		    int nmb_u, int nmb_v,
+		    shared_ptr<LRSplineSurface>& surf);
+
     /// Compute point cloud distance with respect to an LR B-spline surface
     void computeDistPointSpline(std::vector<double>& points,
 				shared_ptr<LRSplineSurface>& surf,
@@ -142,6 +176,45 @@ namespace Go
 				     double& avdist, int& nmb_points,
 				     std::vector<int>& classification,
 				     std::vector<int>& nmb_group);
+
+    /// Compute, for each entry in the element mesh of a 1D surface (see
+    /// LRSplineSurface::constructElementMesh), lower and upper bounds on
+    /// the surface values in the element, i.e. the smallest and largest
+    /// coefficient of the B-splines with support in the element.
+    /// bounds.size() == 2*elements.size(). Rational surfaces get infinite
+    /// bounds.
+    void computeElementBounds(shared_ptr<LRSplineSurface>& surf,
+			      std::vector<Element2D*>& elements,
+			      std::vector<double>& bounds);
+
+    /// Classify points according to their vertical distance to an LR
+    /// B-spline surface, as categorizeCloudFromDist, but evaluate the
+    /// surface only when needed. If the distance range given by the
+    /// element bounds lies within one class, the point is classified
+    /// from the bounds. Only points close to a threshold are evaluated
+    /// exactly. The limits must be increasing. The points are neither
+    /// sorted nor copied, and the classification (-1 for points outside
+    /// the domain) is appended in input order. Thus a large cloud can be
+    /// streamed through the function in chunks, reusing the elements
+    /// and bounds. nmb_group (size limits.size()+1) is added to.
+    /// Multi-threaded if OpenMP is enabled. Throws if the surface is
+    /// not 1D.
+    /// Returns the number of exact surface evaluations.
+    int categorizeCloudFromDistBound(const double* points, int nmb_pts,
+				     shared_ptr<LRSplineSurface>& surf,
+				     std::vector<Element2D*>& elements,
+				     std::vector<double>& bounds,
+				     const std::vector<double>& limits,
+				     std::vector<int>& classification,
+				     std::vector<int>& nmb_group);
+
+    /// Convenience version of the above computing the element mesh and
+    /// the bounds. classification and nmb_group are reset.
+    int categorizeCloudFromDistBound(const std::vector<double>& points,
+				     shared_ptr<LRSplineSurface>& surf,
+				     const std::vector<double>& limits,
+				     std::vector<int>& classification,
+				     std::vector<int>& nmb_group);
   };
 };
 
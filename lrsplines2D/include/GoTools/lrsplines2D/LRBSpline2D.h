@@ -202,7 +202,7 @@ class LRBSpline2D : public Streamable
 
   // Access the coefficient multiplied by the gamma factor (to get the pure coefficient,
   // divide by the gamma factor, which can be obtained by the gamma() member function below).
-        Point& coefTimesGamma()       { return coef_times_gamma_;}
+  // Use setCoefTimesGamma() to change it.
   const Point& coefTimesGamma() const { return coef_times_gamma_;}
 
         Point Coef()       { return coef_times_gamma_/gamma_;}
@@ -213,8 +213,7 @@ class LRBSpline2D : public Streamable
         double& gamma()       {return gamma_;}
   const double& gamma() const {return gamma_;}
 
-  // Access the rational weight of this LRBSpline2D.
-        double& weight()       {return weight_;}
+  // Access the rational weight of this LRBSpline2D. Use setWeight() to change it.
   const double& weight() const {return weight_;}
 
   const bool rational() const {return rational_;}
@@ -331,6 +330,30 @@ class LRBSpline2D : public Streamable
     {
       gamma_ = gamma;
       coef_times_gamma_ = coef*gamma;;
+      coefsModified();
+    }
+
+  /// Set the coefficient multiplied by the gamma factor
+  void setCoefTimesGamma(const Point& coef_times_gamma)
+    {
+      coef_times_gamma_ = coef_times_gamma;
+      coefsModified();
+    }
+
+  /// Set the rational weight
+  void setWeight(double weight)
+    {
+      weight_ = weight;
+      coefsModified();
+    }
+
+  /// Tell the elements in the support of this B-spline that the
+  /// coefficient or the weight is changed. Called by the functions
+  /// setting the coefficient or the weight
+  void coefsModified()
+    {
+      for (size_t ki=0; ki<support_.size(); ++ki)
+	support_[ki]->eraseBezierCoefs();
     }
 
   void reverseParameterDirection(bool dir_is_u);
@@ -349,6 +372,16 @@ class LRBSpline2D : public Streamable
   /// \return          a vector of the coefficients of the control points p_ij in order p_00[0], p_00[1], ..., p_10[0], ..., p_01[0], ...
   std::vector<double> unitSquareBernsteinBasis(double start_u, double stop_u, double start_v, double stop_v) const;
 
+  /// For a given interval inside one of the segments in the knot vector of a given direction, the
+  /// univariate B-spline in the direction is a polynomial. After transforming the rectangle to the
+  /// unit square, this polynomial can be expressed by the Bernstein basis.
+  /// This function returns the coefficients for this expression.
+  /// \param start     the minimum value of the given interval
+  /// \param stop      the maximum value of the given interval
+  /// \param d         the direction (XFIXED for first parameter, YFIXED for second parameter)
+  /// \return          a vector with the coefficients
+  std::vector<double> unitIntervalBernsteinBasis(double start, double stop, Direction2D d) const;
+
  private:
 
   Point coef_times_gamma_;
@@ -364,16 +397,6 @@ class LRBSpline2D : public Streamable
   // Used in least squares approximation with smoothing
   int coef_fixed_;  // 0=free coefficients, 1=fixed, 2=not affected
 
-  /// For a given interval inside one of the segments in the knot vector of a given direction, the
-  /// univariate B-spline in the direction is a polynomial. After transforming the rectangle to the
-  /// unit square, this polynomial can be expressed by the Bernstein basis.
-  /// This function returns the coefficients for this expression.
-  /// \param start     the minimum value of the given interval
-  /// \param stop      the maximum value of the given interval
-  /// \param d         the direction (XFIXED for first parameter, YFIXED for second parameter)
-  /// \return          a vector with the coefficients
-  std::vector<double> unitIntervalBernsteinBasis(double start, double stop, Direction2D d) const;
-
 }; // end class LRBSpline2D
 
  inline std::ostream& operator<<(std::ostream& os, const LRBSpline2D& b) {b.write(os); return os;}
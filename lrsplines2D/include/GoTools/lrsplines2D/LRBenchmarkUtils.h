@@ -51,6 +51,14 @@ namespace Go
 				 const std::vector<LRSplineSurface::Refinement2D>& refs,
 				 bool single_insertions = false);
 
+    // Time writing and reading the surface through a memory stream, in
+    // the text format (write()/read()) and in the binary format
+    // (writeBinary()/readBinary()). The sizes are given in bytes.
+    void benchmarkSfIO(const LRSplineSurface& lr_sf,
+		       double& time_write_text, double& time_read_text,
+		       double& time_write_binary, double& time_read_binary,
+		       size_t& size_text, size_t& size_binary);
+
 }
 
 #endif // _LRBENCHMARKUTILS_H
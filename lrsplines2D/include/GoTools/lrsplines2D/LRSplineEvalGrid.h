@@ -102,20 +102,26 @@ public:
       Point result(dim_);
       result.setValue(0.0);
 
-      const std::vector<LRBSpline2D*> covering_B_functions = elem.getSupport();
-
-      for (auto b = covering_B_functions.begin();
-	   b != covering_B_functions.end(); ++b)
+      if (elem.hasBezierCoefs())
+	elem.evalBezier(scaledU, scaledV, 0, result.begin());
+      else
 	{
-	  const bool u_on_end = (scaledU == (*b)->umax());
-	  const bool v_on_end = (scaledV == (*b)->vmax());
-
-	  result += (*b)->eval(scaledU, 
-			       scaledV, 
-			       0, // No derivs.
-			       0, // No derivs.
-			       u_on_end, 
-			       v_on_end);
+	  const std::vector<LRBSpline2D*>& covering_B_functions =
+	    elem.getSupport();
+
+	  for (auto b = covering_B_functions.begin();
+	       b != covering_B_functions.end(); ++b)
+	    {
+	      const bool u_on_end = (scaledU == (*b)->umax());
+	      const bool v_on_end = (scaledV == (*b)->vmax());
+
+	      result += (*b)->eval(scaledU, 
+				   scaledV, 
+				   0, // No derivs.
+				   0, // No derivs.
+				   u_on_end, 
+				   v_on_end);
+	    }
 	}
 
       if (dim_ == 3)
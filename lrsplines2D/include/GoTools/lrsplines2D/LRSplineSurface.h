@@ -208,6 +208,19 @@ namespace Go
   virtual void  read(std::istream& is);       
   virtual void write(std::ostream& os) const; 
 
+  /// Read a surface written by writeBinary(). Throws if the stream does
+  /// not contain a binary LR spline surface of a known version or if it
+  /// was written on a machine with different byte order.
+  void readBinary(std::istream& is);
+
+  /// Write the surface in a compact binary format. The knot indices of
+  /// the basis functions are delta encoded with a variable number of bytes,
+  /// and the coefficients, the scaling factors and the weights are
+  /// written as contiguous arrays. The stream should be opened in binary
+  /// mode. The format is not portable between machines of different byte
+  /// order.
+  void writeBinary(std::ostream& os) const;
+
   // ----------------------------------------------------
   // Inherited from GeomObject
   // ----------------------------------------------------
@@ -537,6 +550,17 @@ namespace Go
   // The construction can speed up evaluation in many points by making
   // it possible to avoid searching of the correct element
   void constructElementMesh(std::vector<Element2D*>& elements) const;
+
+  // Compute the Bezier coefficients of all elements that do not have
+  // them (see Element2D::setBezierCoefs()). Evaluation in elements with
+  // Bezier coefficients does not traverse the B-splines. The coefficients
+  // of an element are removed when the element is affected by refinement
+  // or coefficient changes, and are recomputed by the next call. Call this
+  // function before evaluating from several threads
+  void computeBezierCoefs() const;
+
+  // Remove the Bezier coefficients of all elements
+  void eraseBezierCoefs();
  
   // Returns pointers to all basis functions whose support covers the parametric point (u, v). 
   // (NB: ownership of the pointed-to LRBSpline2Ds is retained by the LRSplineSurface.)
@@ -562,7 +586,7 @@ namespace Go
   bool isFullTensorProduct() const;
 
   /// Tolerance for equality of knots
-  double getKnotTol()
+  double getKnotTol() const
   {
     return knot_tol_;
   }
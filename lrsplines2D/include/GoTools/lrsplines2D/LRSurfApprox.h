@@ -247,6 +247,16 @@ class LRSurfApprox
       useMBA_ = useMBA;
     }
 
+    /// Decide if the refinement levels of the surface should be used
+    /// as multigrid preconditioner when solving the least squares
+    /// system (default == false). The number of iterations is nearly
+    /// independent of the size of the system, but the hierarchy must
+    /// be updated in each iteration
+    void setUseMultigrid(bool use_multigrid)
+    {
+      use_multigrid_ = use_multigrid;
+    }
+
     /// Add lower constraint. Only functional (1D surface)
     void addLowerConstraint(double minval)
     {
@@ -361,6 +371,9 @@ class LRSurfApprox
 
     bool fix_boundary_;
     bool make_ghost_points_;
+    bool use_multigrid_;  // Multigrid preconditioner in least squares
+    std::vector<LRSplineSurface::Refinement2D> last_refs_;  // Refinements 
+    // performed in the last call to refineSurf
 
     /// Define free and fixed coefficients
     void setCoefKnown();
@@ -374,6 +387,10 @@ class LRSurfApprox
     void computeAccuracy(std::vector<Element2D*>& ghost_elems);
     // The same as the above, but with OpenMP support (if flag is turned on).
     void computeAccuracy_omp(std::vector<Element2D*>& ghost_elems);
+    // Add the stored accuracy information of an element that is not
+    // changed since the last accuracy check to the global statistics
+    void accumulateElementAccuracy(Element2D* elem, int nmb_pts, int nmb_ghost,
+				   std::vector<Element2D*>& ghost_elems);
     void computeAccuracyElement(std::vector<double>& points, int nmb, int del,
 				RectDomain& rd, const Element2D* elem);
     // The same as the above, but with OpenMP support (if flag is turned on).
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+
+#ifndef LRSURFMULTIGRID_H
+#define LRSURFMULTIGRID_H
+
+#include "GoTools/lrsplines2D/LRSplineSurface.h"
+#include <vector>
+
+namespace Go
+{
+  /// Multigrid preconditioned conjugate gradient solver for equation
+  /// systems set up in the spline space of an LR B-spline surface, for
+  /// instance by LRSurfSmoothLS.
+  /// The levels are the spline spaces of the refinement history of the
+  /// surface, starting with the coarsest one. The prolongation from one
+  /// level to the next is computed by knot insertion, i.e. by applying
+  /// the refinements of the surface to a copy of the previous level.
+  /// The restriction is the transposed prolongation, and the coarse
+  /// matrices are computed by the Galerkin product. One V-cycle with
+  /// symmetric Gauss-Seidel smoothing and a direct solve at the coarsest
+  /// level is applied as preconditioner.
+  /// The unknowns at the finest level are the coefficients of the
+  /// B-splines that are not fixed, in the order of the B-spline map,
+  /// with respect to the B-splines scaled by gamma.
+
+  class LRSurfMultigrid
+  {
+  public:
+    /// Sparse matrix in compressed row format
+    struct SparseMatrix
+    {
+      int nmb_rows;
+      int nmb_cols;
+      std::vector<int> irow;    // Start of each row in jcol and val, size nmb_rows+1
+      std::vector<int> jcol;    // Column index of the non-zero entries
+      std::vector<double> val;  // Non-zero entries
+
+      SparseMatrix()
+	: nmb_rows(0), nmb_cols(0)
+      {
+      }
+    };
+
+    /// Constructor. The spline space of surf is the coarsest level.
+    /// \param max_levels maximum number of levels. If more levels are
+    ///                   added, the coarsest levels are merged
+    LRSurfMultigrid(const LRSplineSurface& surf, int max_levels = 8);
+
+    /// Destructor
+    ~LRSurfMultigrid();
+
+    /// Add a level given by refining the finest level with refs, i.e.
+    /// with the refinements applied to the surface. The resulting spline
+    /// space does not depend on the order of the refinements. Returns
+    /// false if the prolongation could not be computed, in which case
+    /// the hierarchy is invalid
+    bool addLevel(const std::vector<LRSplineSurface::Refinement2D>& refs,
+		  bool absolute = false);
+
+    /// Number of levels including the finest one
+    int numLevels() const
+    {
+      return valid_ ? (int)prolong_.size() + 1 : 0;
+    }
+
+    /// Check if the spline space of surf equals the finest level
+    bool matchesSurface(const LRSplineSurface& surf) const;
+
+    /// Attach the left side of the equation system and compute the
+    /// coarse level matrices. The coefficients of the B-splines of surf
+    /// that are fixed are not part of the system.
+    /// \param gmat the system matrix, size nn*nn
+    /// \param nn the number of unknowns
+    void attachMatrix(const LRSplineSurface& surf, const double *gmat, int nn);
+
+    /// Solve the equation system by the preconditioned conjugate
+    /// gradient method. The convergence criterion is as in SolveCG.
+    /// \param ex the solution vector. The input is the initial guess.
+    /// \param eb the right side of the equation system.
+    /// \param nn the number of unknowns
+    /// \return 0: success, 1: iteration count exceeded, < 0: error.
+    int solve(double *ex, const double *eb, int nn);
+
+    /// Set numerical tolerance used by the solver.
+    void setTolerance(double tolerance = 1.0e-6)
+    {
+      tolerance_ = tolerance;
+    }
+
+    /// Set the maximal number of iterations to be used by the solver.
+    void setMaxIterations(int max_iterations)
+    {
+      max_iterations_ = max_iterations;
+    }
+
+    /// Number of iterations used in the last call to solve
+    int numIterations() const
+    {
+      return nmb_iter_;
+    }
+
+  private:
+    // Spline space of the finest level. The coefficients are not used
+    shared_ptr<LRSplineSurface> finest_;
+    int max_levels_;
+    bool valid_;
+
+    // Prolongation from level ki to level ki+1 with respect to all
+    // B-splines of the levels. Level 0 is the coarsest
+    std::vector<SparseMatrix> prolong_;
+
+    // Matrices of the current equation system. The prolongation to the
+    // finest level is restricted to the unknowns
+    std::vector<SparseMatrix> mat_;
+    SparseMatrix fine_prolong_;
+    std::vector<SparseMatrix> restrict_;
+    std::vector<double> coarse_fac_;  // Cholesky factor at coarsest level
+    bool coarse_direct_;
+
+    // Scratch for the V-cycle
+    std::vector<std::vector<double> > res_;
+    std::vector<std::vector<double> > rhs_;
+    std::vector<std::vector<double> > sol_;
+
+    double tolerance_;
+    int max_iterations_;
+    int nmb_iter_;
+
+    // Prolongation matrix from level ki to level ki+1, restricted to the
+    // unknowns if ki+1 is the finest level
+    const SparseMatrix& prolongation(int ki) const;
+
+    // Apply one V-cycle starting at the given level with zero
+    // initial guess
+    void vcycle(int level, const double *b, double *x);
+
+    // Solve at the coarsest level, directly if the coarsest matrix is
+    // small and positive definite, otherwise by symmetric Gauss-Seidel
+    void coarseSolve(const double *b, double *x);
+  };
+
+} // namespace Go
+
+#endif // LRSURFMULTIGRID_H
@@ -58,6 +58,7 @@
 #include <vector>
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/LRBSpline2D.h"
+#include "GoTools/lrsplines2D/LRSurfMultigrid.h"
 
 namespace Go
 {
@@ -132,6 +133,27 @@ class LRSurfSmoothLS
   ///               weight should lie in the unit interval.
   void setLeastSquares(std::vector<double>& points, const double weight);
 
+  /// Use a multigrid preconditioner when solving the equation system.
+  /// The levels are given by the surface when it is set and the
+  /// refinements registered by addRefinementLevel. Without registered
+  /// refinements, or if the surface does not correspond to the finest
+  /// level, RILU preconditioning is applied. Must be called before the
+  /// surface is set to have effect on the current surface.
+  /// \param max_levels maximum number of levels kept
+  void setMultigrid(bool use_multigrid, int max_levels=8);
+
+  /// Register that the surface is refined by refs, applied one at the
+  /// time as in LRSplineSurface::refine(const Refinement2D&, bool).
+  /// The previous surface becomes a coarser level in the multigrid
+  /// preconditioner
+  void addRefinementLevel(const std::vector<LRSplineSurface::Refinement2D>& refs,
+			  bool absolute=false);
+
+  /// Check if the multigrid preconditioner is applied when solving
+  /// the equation system for the current surface. Returns false
+  /// after a solve where the multigrid iteration did not converge
+  bool multigridActive() const;
+
   /// Solve equation system, and produce output surface.
   /// If failing to solve the routine may throw an exception.
   /// \param surf the output surface.
@@ -150,6 +172,10 @@ class LRSurfSmoothLS
   BsplineIndexMap BSmap_;   // Indices to all LR B-splines to associate
                             // a posistion in the stiffness matrix
 
+  bool use_multigrid_;
+  int mg_max_levels_;
+  shared_ptr<LRSurfMultigrid> multigrid_;  // Refinement levels of the surface
+
   // Compute the least squares contributions to the stiffness matrix and
   // the right hand side for a specified set of B-splines
   void localLeastSquares(std::vector<double>& points, 
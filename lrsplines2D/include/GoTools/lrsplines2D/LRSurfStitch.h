@@ -85,19 +85,37 @@ namespace Go
 					  int num_edge_samples = 100);
 
   private:
+    // A boundary shared between two adjacent surfaces in the grid, given
+    // by the surface indices and the edge numbers in each surface.
+    // Edges are numbered: 0=left, 1=right, 2=lower, 3=upper
+    struct GridEdge
+    {
+      int sf1, edge1;
+      int sf2, edge2;
+    };
+
     void consistentSplineSpaces(std::vector<shared_ptr<LRSplineSurface> >& sfs,
 				int nmb_u, int nmb_v, double eps,
 				int cont);
 
-    // Make sure that the refinements along all edges have a full tensor product structure for
-    // the first 'element_width' elements.
+    // Collect the boundaries shared between two existing surfaces
+    void collectGridEdges(std::vector<shared_ptr<LRSplineSurface> >& sfs,
+			  int nmb_u, int nmb_v, std::vector<GridEdge>& edges);
+
+    // Compute the refinements needed to give a full tensor product structure for
+    // the first 'element_width' elements along the specified edges.
     // For corners additional knots are inserted.
     void tensorStructure(shared_ptr<LRSplineSurface> surf, int element_width,
-			 bool edges[4]);
+			 bool edges[4],
+			 std::vector<LRSplineSurface::Refinement2D>& refs);
 
+    // Compute the refinements needed to get corresponding spline spaces
+    // along the common edge of two surfaces. The surfaces are not modified
     bool matchSplineSpace(shared_ptr<LRSplineSurface> surf1, int edge1,
 			  shared_ptr<LRSplineSurface> surf2, int edge2, 
-			  int element_width, double tol);
+			  int element_width, double tol,
+			  std::vector<LRSplineSurface::Refinement2D>& refs1,
+			  std::vector<LRSplineSurface::Refinement2D>& refs2);
 
     void checkCornerMatch(std::vector<std::pair<shared_ptr<LRSplineSurface>,int> >& sfs,
 			 double tol, std::vector<int>& nmb_match,
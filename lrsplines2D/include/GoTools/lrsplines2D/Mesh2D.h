@@ -93,6 +93,15 @@ public:
   // Write the mesh to a stream
   virtual void write(std::ostream& os) const; 
 
+  // Read the mesh from a stream in the binary format of writeBinary()
+  void readBinary(std::istream& is);
+
+  // Write the mesh to a stream in a compact binary format. The knot
+  // values are stored as raw doubles, the mesh rectangles as variable
+  // length encoded differences between consecutive start indices.
+  // The stream should be opened in binary mode.
+  void writeBinary(std::ostream& os) const;
+
   // Swap two meshes
   void swap(Mesh2D& rhs);             
 
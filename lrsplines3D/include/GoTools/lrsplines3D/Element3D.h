@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef ELEMENT3D_H
+#define ELEMENT3D_H
+
+#include <vector>
+#include "GoTools/lrsplines3D/Direction3D.h"
+
+namespace Go
+{
+
+class LRBSpline3D;
+
+// =============================================================================
+/// An element of an LR spline volume, i.e. a box in the parameter domain
+/// where all supported B-splines are polynomials. The element keeps track
+/// of the B-splines with support in the box and, during approximation, of
+/// the data points inside it and the accuracy in these points.
+class Element3D
+// =============================================================================
+{
+ public:
+  /// Constructor given the lower and upper corner of the box
+  Element3D(const double low[3], const double high[3]);
+
+  ~Element3D() {}
+
+  double low(Direction3D d) const  { return low_[d]; }
+  double high(Direction3D d) const { return high_[d]; }
+  double umin() const { return low_[XDIR]; }
+  double vmin() const { return low_[YDIR]; }
+  double wmin() const { return low_[ZDIR]; }
+  double umax() const { return high_[XDIR]; }
+  double vmax() const { return high_[YDIR]; }
+  double wmax() const { return high_[ZDIR]; }
+  double volume() const
+  {
+    return (high_[0] - low_[0])*(high_[1] - low_[1])*(high_[2] - low_[2]);
+  }
+
+  bool contains(double u, double v, double w) const
+  {
+    return (u >= low_[0] && u <= high_[0] && v >= low_[1] && v <= high_[1] &&
+	    w >= low_[2] && w <= high_[2]);
+  }
+
+  const std::vector<LRBSpline3D*>& getSupport() const { return support_; }
+  int nmbBasisFunctions() const { return (int)support_.size(); }
+  void addSupportFunction(LRBSpline3D* f);
+  void removeSupportFunction(LRBSpline3D* f);
+  /// Replace the supporting B-splines. No check for duplicates
+  void setSupportFunctions(const std::vector<LRBSpline3D*>& functions)
+  { support_ = functions; }
+
+  /// Split the element at 'val' in direction 'd'. This element keeps the
+  /// lower part, the upper part is returned. The supporting B-splines are
+  /// copied to the new element and must be updated by the caller. Data
+  /// points are distributed between the two elements.
+  Element3D* split(Direction3D d, double val);
+
+  // --- Data points for approximation ---
+
+  /// Add data points. Each point is stored as (u, v, w, value, distance),
+  /// where the value has dimension 'del' - 4 and the distance is the
+  /// current error of the volume in the point
+  void addDataPoints(std::vector<double>::const_iterator start,
+		     std::vector<double>::const_iterator end, int del);
+  std::vector<double>& getDataPoints() { return data_points_; }
+  const std::vector<double>& getDataPoints() const { return data_points_; }
+  int nmbDataPoints() const
+  { return (del_ > 0) ? (int)data_points_.size()/del_ : 0; }
+  int dataPointSize() const { return del_; }
+  void eraseDataPoints() { data_points_.clear(); }
+
+  // --- Accuracy information ---
+
+  bool hasAccuracyInfo() const { return max_error_ >= 0.0; }
+  void setAccuracyInfo(double average_error, double max_error,
+		       int nmb_outside_tol)
+  {
+    average_error_ = average_error;
+    max_error_ = max_error;
+    nmb_outside_tol_ = nmb_outside_tol;
+  }
+  void getAccuracyInfo(double& average_error, double& max_error,
+		       int& nmb_outside_tol) const
+  {
+    average_error = average_error_;
+    max_error = max_error_;
+    nmb_outside_tol = nmb_outside_tol_;
+  }
+  void resetAccuracyInfo()
+  {
+    average_error_ = 0.0;
+    max_error_ = -1.0;
+    nmb_outside_tol_ = -1;
+  }
+  double getMaxError() const { return max_error_; }
+  int getNmbOutsideTol() const { return nmb_outside_tol_; }
+
+ private:
+  double low_[3];
+  double high_[3];
+  std::vector<LRBSpline3D*> support_;
+
+  std::vector<double> data_points_;
+  int del_;
+  double average_error_;
+  double max_error_;
+  int nmb_outside_tol_;
+};
+
+} // end namespace Go
+
+#endif // ELEMENT3D_H
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef LRBSPLINE3D_H
+#define LRBSPLINE3D_H
+
+#include <vector>
+#include "GoTools/utils/Point.h"
+#include "GoTools/geometry/Streamable.h"
+#include "GoTools/lrsplines3D/Direction3D.h"
+
+namespace Go
+{
+
+class Element3D;
+
+// =============================================================================
+/// A trivariate B-spline function in an LR spline volume. It is given by
+/// its local knot vectors in the three parameter directions, a coefficient
+/// and a scaling factor, gamma, ensuring partition of unity. The coefficient
+/// is stored multiplied by gamma.
+///
+/// The local knot vectors contain knot values, not indices to the knot
+/// vectors of the mesh (c.f. Mesh3D). Only non-rational functions are
+/// supported.
+class LRBSpline3D : public Streamable
+// =============================================================================
+{
+ public:
+  /// Constructor to create an empty (invalid) LRBSpline3D
+  LRBSpline3D() : gamma_(1.0) {}
+
+  /// Constructor. 'kvec_u_start' etc. point to 'deg_u'+2 consecutive knot
+  /// values
+  template<typename Iterator>
+  LRBSpline3D(const Point& c_g, int deg_u, int deg_v, int deg_w,
+	      Iterator kvec_u_start, Iterator kvec_v_start,
+	      Iterator kvec_w_start, double gamma)
+    : coef_times_gamma_(c_g), gamma_(gamma)
+  {
+    kvec_[0].assign(kvec_u_start, kvec_u_start + deg_u + 2);
+    kvec_[1].assign(kvec_v_start, kvec_v_start + deg_v + 2);
+    kvec_[2].assign(kvec_w_start, kvec_w_start + deg_w + 2);
+  }
+
+  /// Copy constructor. The support is not copied
+  LRBSpline3D(const LRBSpline3D& rhs);
+
+  virtual ~LRBSpline3D() {}
+
+  /// Write the LRBSpline3D to a stream
+  virtual void write(std::ostream& os) const;
+
+  /// Read the LRBSpline3D from a stream
+  virtual void read(std::istream& is);
+
+  // ---------------------------
+  // --- EVALUATION FUNCTIONS ---
+  // ---------------------------
+
+  /// Value or partial derivative of the basis function, not multiplied by
+  /// gamma or the coefficient. At the upper end of the domain the basis
+  /// function should be evaluated from the left, indicated by 'u_at_end' etc.
+  double evalBasisFunction(double u, double v, double w,
+			   int u_deriv = 0, int v_deriv = 0, int w_deriv = 0,
+			   bool u_at_end = false, bool v_at_end = false,
+			   bool w_at_end = false) const;
+
+  /// Value or partial derivative of the basis function multiplied by
+  /// gamma and the coefficient
+  Point eval(double u, double v, double w,
+	     int u_deriv = 0, int v_deriv = 0, int w_deriv = 0,
+	     bool u_at_end = false, bool v_at_end = false,
+	     bool w_at_end = false) const
+  {
+    return evalBasisFunction(u, v, w, u_deriv, v_deriv, w_deriv,
+			     u_at_end, v_at_end, w_at_end)*coef_times_gamma_;
+  }
+
+  /// Values and derivatives up to order 'derivs' of the univariate basis
+  /// function in direction 'd' at 'par'. 'res' must have room for
+  /// 'derivs'+1 values
+  void evalUnivariate(Direction3D d, double par, int derivs, bool at_end,
+		      double res[]) const;
+
+  // -----------------------
+  // --- QUERY FUNCTIONS ---
+  // -----------------------
+
+  int degree(Direction3D d) const { return (int)kvec_[d].size() - 2; }
+  const std::vector<double>& kvec(Direction3D d) const { return kvec_[d]; }
+  double min(Direction3D d) const { return kvec_[d].front(); }
+  double max(Direction3D d) const { return kvec_[d].back(); }
+
+  /// Multiplicity of the first and the last knot in direction 'd'
+  int startMult(Direction3D d) const;
+  int endMult(Direction3D d) const;
+
+  /// Number of occurrences of 'val' in the knot vector in direction 'd'
+  int knotCount(Direction3D d, double val) const;
+
+  /// Check if the support of the function overlaps the open box given by
+  /// 'start' and 'end'
+  bool overlaps(const double start[3], const double end[3]) const;
+
+  int dimension() const { return coef_times_gamma_.dimension(); }
+
+        Point& coefTimesGamma()       { return coef_times_gamma_; }
+  const Point& coefTimesGamma() const { return coef_times_gamma_; }
+        double& gamma()       { return gamma_; }
+  const double& gamma() const { return gamma_; }
+  Point coef() const { return coef_times_gamma_/gamma_; }
+
+  /// Split the function by inserting the knot 'val' in direction 'd'. 'val'
+  /// must lie inside the support. The two new functions add up to this
+  /// function. The caller is responsible for deleting them.
+  void split(Direction3D d, double val, LRBSpline3D*& b1, LRBSpline3D*& b2) const;
+
+  // ---------------------------------
+  // --- ELEMENT RELATED FUNCTIONS ---
+  // ---------------------------------
+
+  const std::vector<Element3D*>& supportedElements() const { return support_; }
+  void setSupport(const std::vector<Element3D*>& elements) { support_ = elements; }
+  void addSupport(Element3D* el);
+  void removeSupport(Element3D* el);
+
+ private:
+  Point coef_times_gamma_;
+  double gamma_;
+  std::vector<double> kvec_[3];
+  std::vector<Element3D*> support_;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const LRBSpline3D& b)
+{ b.write(os); return os; }
+inline std::istream& operator>>(std::istream& is, LRBSpline3D& b)
+{ b.read(is); return is; }
+
+} // end namespace Go
+
+#endif // LRBSPLINE3D_H
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef LRSPLINEVOLUME_H
+#define LRSPLINEVOLUME_H
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "GoTools/geometry/GeomObject.h"
+#include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/lrsplines3D/Direction3D.h"
+#include "GoTools/lrsplines3D/Mesh3D.h"
+#include "GoTools/lrsplines3D/LRBSpline3D.h"
+#include "GoTools/lrsplines3D/Element3D.h"
+
+namespace Go
+{
+
+// =============================================================================
+/// A locally refinable (LR) spline volume. The volume is the sum of a set of
+/// LRBSpline3D functions defined on a Mesh3D. Refinement is performed by
+/// inserting mesh rectangles, each splitting the B-splines whose support it
+/// traverses completely. The elements of the volume are the boxes of the
+/// parameter domain not intersected by any mesh rectangle.
+///
+/// Only non-rational volumes are supported.
+class LRSplineVolume : public GeomObject
+// =============================================================================
+{
+ public:
+  // Structure representing a refinement to carry out, i.e. a mesh rectangle
+  // to insert. The rectangle lies in the plane where the parameter in
+  // direction 'd' equals 'kval'. The extent is given in the two other
+  // parameter directions in increasing order (c.f. otherDirections()).
+  struct Refinement3D {
+    double kval;      // value of the fixed parameter of the mesh rectangle
+    double start1;    // start and end value in the first free direction
+    double end1;
+    double start2;    // start and end value in the second free direction
+    double end2;
+    Direction3D d;    // the fixed parameter direction
+    int multiplicity; // multiplicity of the mesh rectangle
+
+    void setVal(double val, double st1, double e1, double st2, double e2,
+		Direction3D dir, int mult)
+    {
+      kval = val;
+      start1 = st1;
+      end1 = e1;
+      start2 = st2;
+      end2 = e2;
+      d = dir;
+      multiplicity = mult;
+    }
+  };
+
+  // 'BSKey' defines the key for storing/looking-up B-spline functions. It
+  // consists of the local knot vectors in the three parameter directions.
+  // As in LRSplineSurface, the use of 'double' values in the key works since
+  // the knot values are always copied from the mesh, never computed.
+  struct BSKey
+  {
+    std::vector<double> knots;
+    bool operator<(const BSKey& rhs) const { return knots < rhs.knots; }
+  };
+  typedef std::map<BSKey, std::unique_ptr<LRBSpline3D> > BSplineMap;
+
+  static BSKey generate_key(const LRBSpline3D& b);
+
+  // An element is identified by its lower corner
+  struct ElemKey
+  {
+    double u_min, v_min, w_min;
+    bool operator<(const ElemKey& rhs) const;
+  };
+  typedef std::map<ElemKey, std::unique_ptr<Element3D> > ElementMap;
+
+  static ElemKey generate_key(double u, double v, double w);
+
+  // ----------------------------------------------------
+  // ---- CONSTRUCTORS, COPY, SWAP AND ASSIGNMENT -------
+  // ----------------------------------------------------
+
+  /// Construct an LR spline volume representing the given non-rational
+  /// spline volume. Knot values closer than 'knot_tol' are treated as equal
+  /// during refinement.
+  LRSplineVolume(const SplineVolume* vol, double knot_tol);
+
+  /// Construct an empty, invalid volume
+  LRSplineVolume() : knot_tol_(1.0e-8), curr_element_(0) {}
+
+  /// Copy constructor. Data points and accuracy information associated with
+  /// the elements are not copied.
+  LRSplineVolume(const LRSplineVolume& rhs);
+
+  LRSplineVolume& operator=(const LRSplineVolume& rhs);
+
+  void swap(LRSplineVolume& rhs);
+
+  virtual ~LRSplineVolume() {}
+
+  // -----------------------------------------
+  // ---- Functions inherited from GeomObject ----
+  // -----------------------------------------
+
+  virtual void read(std::istream& is);
+  virtual void write(std::ostream& os) const;
+
+  /// Bounding box of the coefficients
+  virtual BoundingBox boundingBox() const;
+
+  virtual int dimension() const;
+
+  virtual ClassType instanceType() const { return classType(); }
+  static ClassType classType() { return Class_LRSplineVolume; }
+
+  virtual LRSplineVolume* clone() const { return new LRSplineVolume(*this); }
+
+  // ---------------------------
+  // --- EVALUATION FUNCTIONS ---
+  // ---------------------------
+
+  /// Value or partial derivative of the volume at (u, v, w)
+  Point operator()(double u, double v, double w,
+		   int u_deriv = 0, int v_deriv = 0, int w_deriv = 0) const;
+
+  void point(Point& pt, double u, double v, double w) const
+  { pt = operator()(u, v, w); }
+
+  /// The element containing the parameter (u, v, w). At mesh planes the
+  /// element above is chosen, except at the upper end of the domain.
+  Element3D* coveringElement(double u, double v, double w) const;
+
+  // -----------------------
+  // --- REFINEMENT ---
+  // -----------------------
+
+  /// Insert a mesh rectangle. The plane value is snapped to an existing knot
+  /// within the knot tolerance, the extent is expanded to the nearest knot
+  /// values. Elements that are partly crossed by the rectangle are split
+  /// completely, extending the mesh rectangle correspondingly.
+  void refine(const Refinement3D& ref);
+
+  /// Insert a set of mesh rectangles, c.f. refine(const Refinement3D&)
+  void refine(const std::vector<Refinement3D>& refs);
+
+  /// Set the coefficient of a B-spline
+  void setCoef(const Point& value, LRBSpline3D* target)
+  { target->coefTimesGamma() = value*target->gamma(); }
+
+  // -----------------------
+  // --- QUERY FUNCTIONS ---
+  // -----------------------
+
+  int numBasisFunctions() const { return (int)bsplines_.size(); }
+  int numElements() const { return (int)emap_.size(); }
+  int degree(Direction3D d) const { return deg_[d]; }
+  double paramMin(Direction3D d) const { return mesh_.minParam(d); }
+  double paramMax(Direction3D d) const { return mesh_.maxParam(d); }
+  double knotTol() const { return knot_tol_; }
+  const Mesh3D& mesh() const { return mesh_; }
+
+  BSplineMap::const_iterator basisFunctionsBegin() const { return bsplines_.begin(); }
+  BSplineMap::const_iterator basisFunctionsEnd() const { return bsplines_.end(); }
+  BSplineMap::iterator basisFunctionsBegin() { return bsplines_.begin(); }
+  BSplineMap::iterator basisFunctionsEnd() { return bsplines_.end(); }
+  ElementMap::const_iterator elementsBegin() const { return emap_.begin(); }
+  ElementMap::const_iterator elementsEnd() const { return emap_.end(); }
+
+ private:
+  double knot_tol_;
+  int deg_[3];
+  Mesh3D mesh_;
+  BSplineMap bsplines_;
+  ElementMap emap_;
+  mutable Element3D* curr_element_; // last element found by coveringElement()
+
+  // Insert a single, snapped mesh rectangle in the mesh and split the
+  // elements it crosses
+  void insert_rectangle_(Direction3D d, double kval, const double start[2],
+			 const double end[2], int mult);
+
+  // Split B-splines until all are consistent with the mesh
+  void split_bsplines_();
+
+  // Find a mesh knot in the support of 'b' where 'b' should be split
+  bool find_split_(const LRBSpline3D& b, Direction3D& d, double& val) const;
+
+  // Build the elements from the mesh
+  void construct_element_map_();
+
+  // Compute the elements in the support of each B-spline and vice versa
+  void update_support_();
+};
+
+} // end namespace Go
+
+#endif // LRSPLINEVOLUME_H
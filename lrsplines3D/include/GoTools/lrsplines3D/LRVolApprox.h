@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRVOLAPPROX_H_
+#define _LRVOLAPPROX_H_
+
+#include "GoTools/lrsplines3D/LRSplineVolume.h"
+#include <vector>
+
+namespace Go
+{
+
+/// This class generates an LR spline volume approximating a scalar field
+/// given by scattered data in a 3D parameter domain. The approximation is
+/// computed by multilevel B-spline approximation (MBA) and the volume is
+/// refined locally where the accuracy is not met.
+class LRVolApprox
+{
+ public:
+  /// Constructor given a parameterized point set
+  /// \param points Parameterized point set given as (u1,v1,w1,f1, u2, ...)
+  /// \param ncoef  Number of coefficients in each direction of the
+  ///               initial tensor product volume
+  /// \param order  Polynomial order in each direction
+  /// \param epsge  Requested approximation accuracy
+  LRVolApprox(const std::vector<double>& points, int ncoef, int order,
+	      double epsge);
+
+  /// Compute the approximation.
+  /// \param maxdist Maximum distance between the volume and the data points
+  /// \param avdist  Average distance
+  /// \param nmb_out_eps Number of points with a distance larger than the
+  ///                    tolerance
+  /// \param max_iter Maximum number of refinement steps
+  /// \return The approximating volume
+  shared_ptr<LRSplineVolume> getApproxVol(double& maxdist, double& avdist,
+					  int& nmb_out_eps, int max_iter = 4);
+
+ private:
+  shared_ptr<LRSplineVolume> vol_;
+  double epsge_;
+  double maxdist_;
+  double avdist_;
+  int nmb_outside_tol_;
+
+  // Each data point is stored as (u, v, w, f, residual)
+  static const int del_ = 5;
+
+  // Distribute the data points to the elements of the volume
+  void distributePoints(const std::vector<double>& points);
+
+  // Update the coefficients by one pass of multilevel B-spline approximation
+  void updateCoefsMBA();
+
+  // Compute the residuals in the data points and the accuracy information
+  // of the elements
+  void computeAccuracy();
+
+  // Refine the B-splines with support in elements where the tolerance is
+  // not met
+  void refineVolume();
+};
+
+} // end namespace Go
+
+#endif // _LRVOLAPPROX_H_
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _MESH3D_H
+#define _MESH3D_H
+
+#include <vector>
+#include <map>
+#include <iostream>
+#include "GoTools/geometry/Streamable.h"
+#include "GoTools/lrsplines3D/Direction3D.h"
+
+namespace Go
+{
+
+// =============================================================================
+/// The mesh of an LR spline volume. It consists of the distinct knot values
+/// in each parameter direction and a collection of mesh rectangles. A mesh
+/// rectangle lies in a plane where one parameter is constant and covers a
+/// box in the two other parameters, with a given multiplicity.
+///
+/// Unlike Mesh2D, the mesh rectangles are identified by parameter values,
+/// not by indices into the knot vectors. Knot values are never computed,
+/// only copied from the vectors of distinct knots, so they can be compared
+/// exactly. The indices would change each time a new knot value is
+/// inserted.
+class Mesh3D : public Streamable
+// =============================================================================
+{
+public:
+  /// A mesh rectangle. The extent refers to the two parameter directions
+  /// that are not fixed, in increasing order (c.f. otherDirections())
+  struct MeshRectangle
+  {
+    double start[2];
+    double end[2];
+    int mult;
+  };
+
+  /// Empty mesh
+  Mesh3D() {}
+
+  /// Mesh of a tensor product volume with the given knot vectors, which
+  /// may contain multiple knots
+  template<typename Iterator>
+  Mesh3D(Iterator kx_start, Iterator kx_end, Iterator ky_start, Iterator ky_end,
+	 Iterator kz_start, Iterator kz_end);
+
+  virtual ~Mesh3D() {}
+
+  virtual void read(std::istream& is);
+  virtual void write(std::ostream& os) const;
+
+  void swap(Mesh3D& rhs);
+
+  /// Number of distinct knot values in the given direction
+  int numDistinctKnots(Direction3D d) const
+  { return (int)knots_[d].size(); }
+
+  /// Distinct knot values in the given direction
+  const double* knotsBegin(Direction3D d) const { return &knots_[d][0]; }
+  const double* knotsEnd(Direction3D d) const
+  { return &knots_[d][0] + knots_[d].size(); }
+
+  double kval(Direction3D d, int ix) const { return knots_[d][ix]; }
+  double minParam(Direction3D d) const { return knots_[d].front(); }
+  double maxParam(Direction3D d) const { return knots_[d].back(); }
+
+  /// Index of the knot value within 'tol' of 'val', or -1 if no such knot
+  int knotIndex(Direction3D d, double val, double tol) const;
+
+  /// Index of the knot interval containing 'val'. At the end of the domain
+  /// the last interval is returned.
+  int knotIntervalFuzzy(Direction3D d, double val) const;
+
+  /// The smallest multiplicity of the mesh in the plane where the
+  /// parameter in direction 'd' equals 'kval' over the box defined by
+  /// 'start' and 'end' in the two other directions. 0 if some part of the
+  /// box is not covered. 'kval' must be a knot value of the mesh.
+  int nu(Direction3D d, double kval, const double start[2],
+	 const double end[2]) const;
+
+  /// Add a knot value unless there is one within 'tol'. Returns the value
+  /// stored in the mesh.
+  double addKnot(Direction3D d, double val, double tol);
+
+  /// Insert a mesh rectangle. The plane value and the extent must be knot
+  /// values of the mesh. Mesh rectangles may overlap, in which case the
+  /// largest multiplicity applies.
+  void insertRectangle(Direction3D d, double kval, const double start[2],
+		       const double end[2], int mult);
+
+  /// Total number of mesh rectangles
+  int numRectangles() const;
+
+  /// The mesh rectangles in the plane given by 'd' and 'kval'. Empty if
+  /// there are none.
+  const std::vector<MeshRectangle>& rectangles(Direction3D d, double kval) const;
+
+private:
+  std::vector<double> knots_[3];
+  std::map<double, std::vector<MeshRectangle> > rects_[3];
+
+  // Check that the mesh is read correctly
+  void consistency_check_() const;
+};
+
+// =============================================================================
+template<typename Iterator>
+Mesh3D::Mesh3D(Iterator kx_start, Iterator kx_end, Iterator ky_start,
+	       Iterator ky_end, Iterator kz_start, Iterator kz_end)
+// =============================================================================
+{
+  Iterator start[3] = { kx_start, ky_start, kz_start };
+  Iterator end[3] = { kx_end, ky_end, kz_end };
+  std::vector<int> mult[3];
+  for (int d = 0; d < 3; ++d)
+    for (Iterator it = start[d]; it != end[d]; ++it)
+      {
+	if (knots_[d].size() > 0 && *it == knots_[d].back())
+	  ++mult[d].back();
+	else
+	  {
+	    knots_[d].push_back(*it);
+	    mult[d].push_back(1);
+	  }
+      }
+
+  // Each knot plane is covered by one mesh rectangle
+  for (int d = 0; d < 3; ++d)
+    {
+      Direction3D d1, d2;
+      otherDirections((Direction3D)d, d1, d2);
+      MeshRectangle rect;
+      rect.start[0] = knots_[d1].front();
+      rect.start[1] = knots_[d2].front();
+      rect.end[0] = knots_[d1].back();
+      rect.end[1] = knots_[d2].back();
+      for (size_t ki = 0; ki < knots_[d].size(); ++ki)
+	{
+	  rect.mult = mult[d][ki];
+	  rects_[d][knots_[d][ki]].push_back(rect);
+	}
+    }
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Mesh3D& m)
+{ m.write(os); return os; }
+inline std::istream& operator>>(std::istream& is, Mesh3D& m)
+{ m.read(is); return is; }
+
+} // end namespace Go
+
+#endif // _MESH3D_H
@@ -74,6 +74,16 @@ public:
   /// Solve the linear system, replacing the start vector with the solution.
   void solve(const PrMatrix& A, PrVec& x, const PrVec& b);
 
+  /** Solve the two linear systems Ax1 = b1 and Ax2 = b2 with the same
+   * matrix. The two iterations run side by side so that every
+   * matrix-vector product traverses A once for both systems. Each system
+   * stops on its own residual, and the result equals that of two calls
+   * to solve(). The iteration count is the larger of the two, and the
+   * call has converged only if both systems did.
+   */
+  void solve(const PrMatrix& A, PrVec& x1, const PrVec& b1,
+	     PrVec& x2, const PrVec& b2);
+
   /// Get the number of iterations spent for the last call of 'solve()'.
   int getItCount() {return it_count_; }
 
@@ -104,6 +114,11 @@ Member functions:
                    Solve the linear system, replacing the start vector
                    with the solution.
 
+                   "solve(const PrMatrix& A, PrVec& x1, const PrVec& b1,
+                          PrVec& x2, const PrVec& b2)" --\\
+                   Solve two linear systems with the same matrix,
+                   sharing the matrix-vector products.
+
 Constructors:
 Files:
 Example:
@@ -75,7 +75,7 @@ public:
   /// \param nt vector or triangles.  Will be copied internally
   /// \param level specify the level represented by this triangulation
   PrLevelTriangulation_OP(vector<PrNestedNode>* node,
-                          vector<PrTriangle>& nt, int level = 0);
+                          const vector<PrTriangle>& nt, int level = 0);
 
   /// Empty default destructor.
   ~PrLevelTriangulation_OP() {}
@@ -66,6 +66,8 @@ public:
   virtual double operator () (int i, int j) const;
   /// Find y = Ax
   virtual void prod(const PrVec& x, PrVec& y) const;
+  virtual void prod2(const PrVec& x1, const PrVec& x2,
+		     PrVec& y1, PrVec& y2) const;
   virtual void print(std::ostream& os);
   virtual void read(std::istream& is);
   /// virtual destructor
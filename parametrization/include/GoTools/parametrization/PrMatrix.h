@@ -59,6 +59,10 @@ public:
   virtual double operator () (int i, int j) const = 0;
   /// Multiply matrix with 'x' and return result in 'y'.  (y = Ax)
   virtual void prod(const PrVec& x, PrVec& y) const = 0;
+  /// Multiply matrix with 'x1' and 'x2' and return the results in
+  /// 'y1' and 'y2'.  (y1 = Ax1, y2 = Ax2)  The default calls prod() twice.
+  virtual void prod2(const PrVec& x1, const PrVec& x2,
+		     PrVec& y1, PrVec& y2) const;
   /// Virtual destructor
   virtual ~PrMatrix();
 
@@ -58,6 +58,10 @@ class PrParamTriangulation {
   vector<int>            baseTriangle_;
   vector< vector<int> >  patch_triangles_;
 
+  // Read-only access to the meshes
+  const PrTriangulation_OP& fineMesh() const { return *mesh_; }
+  const PrTriangulation_OP& coarseMesh() const { return *basemesh_; }
+
 public: 
   /// Empty default constructor
   PrParamTriangulation() {}
@@ -152,7 +156,8 @@ public:
   /// Evaluate a point on a given mesh by specifying a triangle on the mesh
   /// and the barycentric coordinates within this triangle.  The point is 
   /// computed by linear interpolation of the triangle's corner nodes.
-  static Vector3D evaluator(PrTriangulation_OP& mesh, int idx, Vector3D& bc);
+  static Vector3D evaluator(const PrTriangulation_OP& mesh, int idx,
+			    Vector3D& bc);
 };
 
 #endif // PRPARAMTRIANGULATION_H
@@ -43,6 +43,8 @@
 #include "GoTools/parametrization/PrOrganizedPoints.h"
 #include <memory>
 
+class PrTriangulation_NT;
+
 /*<PrParametrizeInt-syntax: */
 
 enum PrParamStartVector {
@@ -104,6 +106,10 @@ public:
   /// Empty default destructor
   virtual ~PrParametrizeInt();
 
+  /// Return a copy of this object. computeWeights() gives each thread
+  /// its own copy, since makeWeights() works in member buffers.
+  virtual PrParametrizeInt* clone() const = 0;
+
   /// Set the graph.
   void attach(shared_ptr<PrOrganizedPoints> graph);
 
@@ -118,6 +124,16 @@ public:
   /// Parametrize the given planar graph.
   bool parametrize();
 
+  /** Parametrize the finest level of a nested triangulation, level by
+   * level from the coarsest one. Each level starts from the solution of
+   * the level below, with new nodes placed at the midpoint of their
+   * parents, which leaves fewer iterations on the large systems than
+   * starting from the barycentre. The start vector kind chosen with
+   * setStartVectorKind() applies to the coarsest level. The attached
+   * graph is left unchanged.
+   */
+  bool parametrizeNested(shared_ptr<PrTriangulation_NT> t);
+
   /** Parametrize the nodes of the 3D graph g_ except those
    * with indices in "fixedPnts". The parameterization is done
    * in 3D and the result is returned as vector "uvw"
@@ -176,6 +192,11 @@ Member functions:
                    "parametrize()" --\\
                    Parametrize the given planar graph.
 
+                   "parametrizeNested(shared_ptr<PrTriangulation_NT> t)" --\\
+                   Parametrize the finest level of a nested
+                   triangulation, using each coarser level as the
+                   start vector for the next.
+
 		   "smooth(int nmb)" --\\
 		   performs "nmb" Gauss-Seidel smoothing steps on the sphere
 
@@ -57,6 +57,8 @@ public:
   PrPrmEDDHLS();
   /// Empty destructor 
   virtual ~PrPrmEDDHLS();
+  /// Return a copy of this object.
+  virtual PrPrmEDDHLS* clone() const {return new PrPrmEDDHLS(*this); }
 
 };
 
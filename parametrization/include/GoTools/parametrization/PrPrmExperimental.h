@@ -56,6 +56,8 @@ public:
   PrPrmExperimental();
   /// Empty destructor 
   virtual ~PrPrmExperimental();
+  /// Return a copy of this object.
+  virtual PrPrmExperimental* clone() const {return new PrPrmExperimental(*this); }
 
 };
 
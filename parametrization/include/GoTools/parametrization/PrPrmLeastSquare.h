@@ -59,6 +59,8 @@ public:
   PrPrmLeastSquare();
   /// Empty destructor
   virtual ~PrPrmLeastSquare();
+  /// Return a copy of this object.
+  virtual PrPrmLeastSquare* clone() const {return new PrPrmLeastSquare(*this); }
 
 };
 
@@ -66,6 +66,8 @@ public:
   PrPrmMeanValue();
   /// Empty destructor
   virtual ~PrPrmMeanValue();
+  /// Return a copy of this object.
+  virtual PrPrmMeanValue* clone() const {return new PrPrmMeanValue(*this); }
 
 };
 
@@ -63,6 +63,8 @@ public:
   PrPrmShpPres();
   /// Empty destructor
   virtual ~PrPrmShpPres();
+  /// Return a copy of this object.
+  virtual PrPrmShpPres* clone() const {return new PrPrmShpPres(*this); }
 
 };
 
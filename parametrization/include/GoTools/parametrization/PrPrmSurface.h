@@ -72,6 +72,8 @@ public:
   PrPrmSurface();
   /// Empty destructor
   virtual ~PrPrmSurface();
+  /// Return a copy of this object.
+  virtual PrPrmSurface* clone() const {return new PrPrmSurface(*this); }
 
 };
 
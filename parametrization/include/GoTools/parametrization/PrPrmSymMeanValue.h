@@ -59,6 +59,8 @@ public:
     PrPrmSymMeanValue();
     /// Empty destructor
     ~PrPrmSymMeanValue();
+    /// Return a copy of this object.
+    virtual PrPrmSymMeanValue* clone() const {return new PrPrmSymMeanValue(*this); }
 
 };
 
@@ -59,6 +59,8 @@ public:
   PrPrmUniform();
   /// Empty destructor
   virtual ~PrPrmUniform();
+  /// Return a copy of this object.
+  virtual PrPrmUniform* clone() const {return new PrPrmUniform(*this); }
 
 };
 
@@ -57,6 +57,8 @@ public:
     PrPrmWachspress();
     /// Empty destructor
     virtual ~PrPrmWachspress();
+    /// Return a copy of this object.
+    virtual PrPrmWachspress* clone() const {return new PrPrmWachspress(*this); }
 
 };
 
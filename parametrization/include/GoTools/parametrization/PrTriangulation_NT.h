@@ -67,7 +67,7 @@ public:
   /** Constructor. Construct the PrTriangulation_NT from a PrTriangulation_OP,
    * using just one level in the hierarchy. This can later be refined by refine().
    */
-  PrTriangulation_NT(PrTriangulation_OP& t);
+  PrTriangulation_NT(const PrTriangulation_OP& t);
   /// Empty destructor
   ~PrTriangulation_NT() {}
 
@@ -58,8 +58,20 @@ private:
   std::vector<PrNode> node_;
   std::vector<PrTriangle> triangle_;
 
+  // One-ring adjacency in compressed row form. The neighbours of node i
+  // are nghr_[nghr_start_[i]], ..., nghr_[nghr_start_[i+1]-1], in the
+  // order returned by getNeighbours(), and similarly for the incident
+  // triangles in tr_start_ and tr_. Empty when not valid; the member
+  // functions changing the topology clear the tables and queries fall
+  // back to walking the triangles.
+  std::vector<int> nghr_start_;
+  std::vector<int> nghr_;
+  std::vector<int> tr_start_;
+  std::vector<int> tr_;
+
   int getNghrTriangle(int n1, int n2, std::vector<int>& tlist);
   void buildTopology();
+  void walkNeighbours(int i, std::vector<int>& neighbours) const;
 
 public:
   /// Default constructor.
@@ -133,6 +145,22 @@ public:
   /// Get all triangles that are incident with node 'i'.
   virtual void getTriangles(int i, Go::ScratchVect<int, 20> &triangles) const;
 
+  /// Precompute the neighbours and incident triangles of all nodes, so
+  /// that getNeighbours() and getTriangles() become plain copies. This
+  /// is done on construction. Call it again after modifying the mesh.
+  void buildNeighbourTable();
+
+  /// Whether the precomputed neighbour table is up to date.
+  bool hasNeighbourTable() const {return !nghr_start_.empty();}
+
+  /// Discard the precomputed neighbour table. Must be called before
+  /// changing the topology through the references returned by
+  /// getPrNode(), getPrTriangle() and friends.
+  void clearNeighbourTable();
+
+  /// Number of neighbours of node 'i'.
+  int getNumNeighbours(int i) const;
+
   // mesh modifications
   /// swap triangle t1 and t2
   bool swapTriangles(int t1, int t2);
@@ -147,7 +175,9 @@ public:
   /// node 'i' should be on the boundary, and 'j' should share an edge with 'i'.
   bool splitVertex(int i, int j, std::vector<int> &new_nodes);
 
-  // Grab internal structure for doing thinning
+  // Grab internal structure for doing thinning. Callers changing the
+  // topology through the non-const versions must call
+  // clearNeighbourTable() first.
   /// Get reference to node indexed 'i'.
   inline PrNode& getPrNode(int i) {return node_[i];}
   inline const PrNode& getPrNode(int i) const {return node_[i];}
@@ -157,8 +187,11 @@ public:
   inline PrTriangle& getPrTriangle(int i) {return triangle_[i];}
   /// Get reference to all triangles in the triangulation.
   inline std::vector<PrTriangle>& getTriangleArray() {return triangle_;}
+  inline const std::vector<PrTriangle>& getTriangleArray() const
+  {return triangle_;}
   /// Get reference to all nodes in the triangulation
   inline std::vector<PrNode>& getNodeArray() {return node_;}
+  inline const std::vector<PrNode>& getNodeArray() const {return node_;}
 
   //print and scan routines
 
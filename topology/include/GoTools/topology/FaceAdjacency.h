@@ -45,6 +45,7 @@
 #include "GoTools/utils/Point.h"
 #include "GoTools/utils/BoundingBox.h"
 #include "GoTools/utils/errormacros.h"
+#include "GoTools/utils/Profiler.h"
 #include "GoTools/geometry/ClassType.h"
 #include "GoTools/geometry/CurveOnSurface.h"
 #include "GoTools/geometry/LineCloud.h"
@@ -161,6 +162,7 @@ public:
 		       int first_idx)
     //=======================================================================
     {
+      GO_PROFILE_SCOPE("FaceAdjacency::computeAdjacency");
       int i, j, k, l;
       int num_faces = (int)faces.size();
       std::vector<Go::BoundingBox> boxes;
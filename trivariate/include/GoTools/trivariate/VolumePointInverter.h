@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEPOINTINVERTER_H
+#define _VOLUMEPOINTINVERTER_H
+
+#include "GoTools/trivariate/SplineVolume.h"
+#include <vector>
+
+
+namespace Go
+{
+
+/** Point inversion for a spline volume, i.e. computation of the parameter
+ * values corresponding to points given in geometry space.
+ * The volume is split into its Bezier elements, and a bounding volume
+ * hierarchy over the boxes of the element control points (which contain
+ * the elements) limits the Newton iterations to the elements that may
+ * contain a given point. Points outside the volume are projected onto
+ * the volume by a closest point computation.
+ * The volume must be 3-dimensional and must not be changed as long as
+ * the inverter is in use. The single point functions evaluate the volume
+ * given in the constructor, and must not be called from several threads
+ * at the same time. The batch function may be called at any time.
+ */
+class GO_API VolumePointInverter
+{
+public:
+    /// Constructor
+    /// \param vol the volume
+    /// \param tol geometric tolerance. A point is considered to lie inside
+    ///        the volume if its distance to the volume is less than tol
+    VolumePointInverter(shared_ptr<SplineVolume> vol, double tol = 1.0e-10);
+
+    /// Destructor
+    ~VolumePointInverter();
+
+    /// Compute the parameter values of a point
+    /// \param pt the point
+    /// \param par (out) the parameter values of the point, or of the
+    ///        closest point in the volume if pt lies outside
+    /// \param dist (out) the distance between pt and the volume point
+    ///        at par
+    /// \return true if pt lies inside the volume
+    bool invert(const Point& pt, double par[], double& dist) const;
+
+    /// Compute the parameter values of a point, seeded by the result of
+    /// a previous computation. Meant for points coming in sequence, where
+    /// each point is close to the previous one.
+    /// \param pt the point
+    /// \param par (in/out) on input, if elem >= 0, the start parameter of
+    ///        the iteration. On output as in invert(pt, par, dist)
+    /// \param dist (out) the distance between pt and the volume point
+    ///        at par
+    /// \param elem (in/out) on input, the element to try first or -1.
+    ///        On output, the element containing par
+    /// \return true if pt lies inside the volume
+    bool invert(const Point& pt, double par[], double& dist, int& elem) const;
+
+    /// Compute the parameter values of a number of points. Consecutive
+    /// points are seeded by each other. If OpenMP is enabled the points
+    /// are distributed on the threads, each thread using its own copy
+    /// of the volume
+    /// \param pts the points, stored consecutively (x1, y1, z1, x2, ...)
+    /// \param nmb_pts the number of points
+    /// \param par (out) the parameter values, 3 for each point
+    /// \param dist (out) the distance between each point and the volume
+    ///        point at its parameter values
+    /// \param inside (out) 1 if the point lies inside the volume, 0 if not
+    void invert(const double* pts, int nmb_pts, std::vector<double>& par,
+		std::vector<double>& dist, std::vector<int>& inside) const;
+
+    /// The number of elements of the volume. Elements are numbered with
+    /// the first parameter direction running fastest
+    int numElements() const
+    { return nmb_el_[0]*nmb_el_[1]*nmb_el_[2]; }
+
+    /// The parameter domain of an element, (umin, umax, vmin, vmax, wmin,
+    /// wmax)
+    void elementDomain(int elem, double elem_par[]) const;
+
+private:
+    struct Node
+    {
+	double box_[6];  // xmin, ymin, zmin, xmax, ymax, zmax
+	int child_[2];   // Children, -1 for leaves
+	int first_;      // Range of elements in elem_order_ for leaves
+	int last_;
+    };
+
+    shared_ptr<SplineVolume> vol_;
+    double tol_;
+    int nmb_el_[3];
+    std::vector<double> elem_knots_[3];  // Element limits
+    std::vector<double> elem_box_;       // Box of each element, 6 values
+    std::vector<int> elem_order_;        // Elements sorted by node
+    std::vector<Node> nodes_;            // The root is nodes_[0]
+
+    void makeElementBoxes();
+    int buildTree(int first, int last);
+    bool boxContains(const double box[], const double* pt) const;
+    double boxDist2(const double box[], const double* pt) const;
+    int closestElement(const double* pt) const;
+    int elementOf(const double par[]) const;
+    bool newton(const SplineVolume& vol, const double* pt, double par[],
+		double& dist2) const;
+    bool invertPoint(const SplineVolume& vol, const double* pt,
+		     double par[], double& dist, int& elem) const;
+};
+
+} // namespace Go
+
+#endif // _VOLUMEPOINTINVERTER_H
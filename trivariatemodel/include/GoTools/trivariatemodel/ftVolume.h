@@ -305,6 +305,18 @@ namespace Go
     /// surface is seen as an intersection
    int ElementBoundaryStatus(int elem_ix);
 
+    /// Classify all polynomial elements (for spline volumes) with respect
+    /// to the (trimming) boundaries of this ftVolume. The result for each
+    /// element is the same as from ElementBoundaryStatus(int), but the
+    /// elements are treated in blocks: blocks of elements that are not
+    /// close to any trimming surface get the inside/outside status of one
+    /// representative point, and the intersection tests of the remaining
+    /// elements are run in parallel if OpenMP is enabled.
+    /// \param elem_status Status of each element, indexed as in
+    /// ElementBoundaryStatus(int): 0 = outside, 1 = on boundary, 2 = inside
+    /// \return false if this is not a spline volume
+    bool ElementBoundaryStatus(std::vector<int>& elem_status);
+
     /// Information about whether or not the volume is trimmed and how it
     /// is trimmed
     /// Check if the volume is boundary trimmed (not trimmed). The boundary